@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    auto xs = hana::make_tuple(
+        <%= (1..Math.sqrt(input_size).to_i).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    auto product = hana::experimental::product_view(xs, xs);
+
+    // Only a few combinations are ever created.
+    constexpr std::size_t n = decltype(hana::length(product))::value;
+    auto first = hana::at_c<0>(product);
+    auto middle = hana::at_c<n / 2>(product);
+    auto last = hana::at_c<n - 1>(product);
+    (void)first; (void)middle; (void)last;
+}
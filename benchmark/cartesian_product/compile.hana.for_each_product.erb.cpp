@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    int count = 0;
+    auto xs = hana::make_tuple(
+        <%= (1..Math.sqrt(input_size).to_i).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    hana::for_each_product(hana::make_tuple(xs, xs),
+                           [&](auto const&) { ++count; });
+    return count;
+}
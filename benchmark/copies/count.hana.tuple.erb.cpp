@@ -0,0 +1,205 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adjust_if.hpp>
+#include <boost/hana/append.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/cycle.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/drop_front_exactly.hpp>
+#include <boost/hana/drop_while.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/functional/arg.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/insert_range.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/intersperse.hpp>
+#include <boost/hana/partition.hpp>
+#include <boost/hana/prefix.hpp>
+#include <boost/hana/prepend.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/remove_if.hpp>
+#include <boost/hana/remove_range.hpp>
+#include <boost/hana/replace_if.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/scan_left.hpp>
+#include <boost/hana/scan_right.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/span.hpp>
+#include <boost/hana/suffix.hpp>
+#include <boost/hana/take_back.hpp>
+#include <boost/hana/take_front.hpp>
+#include <boost/hana/take_while.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unique.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/zip.hpp>
+
+#include "counted.hpp"
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::benchmark::counted;
+
+
+constexpr std::size_t elements = <%= input_size %>;
+
+auto make_input() {
+    return hana::make_tuple(
+        <%= input_size.times.map { |i| "counted{std::string(32, 'a' + #{i % 26})}" }.join(', ') %>
+    );
+}
+
+// Calls `f` on a sequence of `elements` counted objects, once with an lvalue
+// and once with an rvalue, and prints the number of copies and moves that
+// were made per element of the sequence, in the format expected by
+// `measure.rb`. Elements created by `f` itself are counted too.
+template <typename F>
+void report(char const* algorithm, F f) {
+    auto print = [&](char const* category, hana::benchmark::counts c) {
+        std::cout << "[copies per element: " << algorithm << " (" << category << "): "
+                  << static_cast<double>(c.copies) / elements << "]\n"
+                  << "[moves per element: " << algorithm << " (" << category << "): "
+                  << static_cast<double>(c.moves) / elements << "]\n";
+    };
+
+    {
+        auto xs = make_input();
+        print("lvalue", hana::benchmark::count_quietly([&] { f(xs); }));
+    }{
+        auto xs = make_input();
+        print("rvalue", hana::benchmark::count_quietly([&] { f(std::move(xs)); }));
+    }
+}
+
+int main() {
+    auto yes = [](auto const& ...) { return hana::true_c; };
+    auto no = [](auto const& ...) { return hana::false_c; };
+    auto all = hana::size_c<elements>;
+
+    report("hana::adjust_if", [=](auto&& xs) {
+        return hana::adjust_if(static_cast<decltype(xs)&&>(xs), no, hana::id);
+    });
+    report("hana::append", [](auto&& xs) {
+        return hana::append(static_cast<decltype(xs)&&>(xs), counted{});
+    });
+    report("hana::concat", [](auto&& xs) {
+        return hana::concat(static_cast<decltype(xs)&&>(xs), hana::make_tuple());
+    });
+    report("hana::cycle", [](auto&& xs) {
+        return hana::cycle(static_cast<decltype(xs)&&>(xs), hana::size_c<2>);
+    });
+    report("hana::drop_back", [](auto&& xs) {
+        return hana::drop_back(static_cast<decltype(xs)&&>(xs), hana::size_c<1>);
+    });
+    report("hana::drop_front", [](auto&& xs) {
+        return hana::drop_front(static_cast<decltype(xs)&&>(xs), hana::size_c<1>);
+    });
+    report("hana::drop_front_exactly", [](auto&& xs) {
+        return hana::drop_front_exactly(static_cast<decltype(xs)&&>(xs), hana::size_c<1>);
+    });
+    report("hana::drop_while", [=](auto&& xs) {
+        return hana::drop_while(static_cast<decltype(xs)&&>(xs), no);
+    });
+    report("hana::filter", [=](auto&& xs) {
+        return hana::filter(static_cast<decltype(xs)&&>(xs), yes);
+    });
+    report("hana::fold_left", [](auto&& xs) {
+        return hana::fold_left(static_cast<decltype(xs)&&>(xs), 0,
+                               [](int n, auto const&) { return n + 1; });
+    });
+    report("hana::for_each", [](auto&& xs) {
+        hana::for_each(static_cast<decltype(xs)&&>(xs), [](auto const&) { });
+    });
+    report("hana::group", [=](auto&& xs) {
+        return hana::group(static_cast<decltype(xs)&&>(xs), no);
+    });
+    report("hana::insert", [](auto&& xs) {
+        return hana::insert(static_cast<decltype(xs)&&>(xs), hana::size_c<1>, counted{});
+    });
+    report("hana::insert_range", [](auto&& xs) {
+        return hana::insert_range(static_cast<decltype(xs)&&>(xs), hana::size_c<1>,
+                                  hana::make_tuple(counted{}));
+    });
+    report("hana::intersperse", [](auto&& xs) {
+        return hana::intersperse(static_cast<decltype(xs)&&>(xs), counted{});
+    });
+    report("hana::partition", [=](auto&& xs) {
+        return hana::partition(static_cast<decltype(xs)&&>(xs), yes);
+    });
+    report("hana::prefix", [](auto&& xs) {
+        return hana::prefix(static_cast<decltype(xs)&&>(xs), counted{});
+    });
+    report("hana::prepend", [](auto&& xs) {
+        return hana::prepend(static_cast<decltype(xs)&&>(xs), counted{});
+    });
+    report("hana::remove_at", [](auto&& xs) {
+        return hana::remove_at(static_cast<decltype(xs)&&>(xs), hana::size_c<0>);
+    });
+    report("hana::remove_if", [=](auto&& xs) {
+        return hana::remove_if(static_cast<decltype(xs)&&>(xs), no);
+    });
+    report("hana::remove_range", [](auto&& xs) {
+        return hana::remove_range(static_cast<decltype(xs)&&>(xs),
+                                  hana::size_c<0>, hana::size_c<1>);
+    });
+    report("hana::replace_if", [=](auto&& xs) {
+        return hana::replace_if(static_cast<decltype(xs)&&>(xs), no, counted{});
+    });
+    report("hana::reverse", [](auto&& xs) {
+        return hana::reverse(static_cast<decltype(xs)&&>(xs));
+    });
+    report("hana::scan_left", [](auto&& xs) {
+        return hana::scan_left(static_cast<decltype(xs)&&>(xs), hana::arg<2>);
+    });
+    report("hana::scan_right", [](auto&& xs) {
+        return hana::scan_right(static_cast<decltype(xs)&&>(xs), hana::arg<1>);
+    });
+    report("hana::slice", [](auto&& xs) {
+        return hana::slice(static_cast<decltype(xs)&&>(xs),
+            hana::tuple_c<std::size_t<%= (0...input_size).to_a.reverse.map { |i| ", #{i}" }.join %>>);
+    });
+    report("hana::sort", [=](auto&& xs) {
+        return hana::sort(static_cast<decltype(xs)&&>(xs), no);
+    });
+    report("hana::span", [=](auto&& xs) {
+        return hana::span(static_cast<decltype(xs)&&>(xs), yes);
+    });
+    report("hana::suffix", [](auto&& xs) {
+        return hana::suffix(static_cast<decltype(xs)&&>(xs), counted{});
+    });
+    report("hana::take_back", [=](auto&& xs) {
+        return hana::take_back(static_cast<decltype(xs)&&>(xs), all);
+    });
+    report("hana::take_front", [=](auto&& xs) {
+        return hana::take_front(static_cast<decltype(xs)&&>(xs), all);
+    });
+    report("hana::take_while", [=](auto&& xs) {
+        return hana::take_while(static_cast<decltype(xs)&&>(xs), yes);
+    });
+    report("hana::transform", [](auto&& xs) {
+        return hana::transform(static_cast<decltype(xs)&&>(xs), [](auto&& x) {
+            return static_cast<decltype(x)&&>(x);
+        });
+    });
+    report("hana::unique", [=](auto&& xs) {
+        return hana::unique(static_cast<decltype(xs)&&>(xs), no);
+    });
+    report("hana::unpack", [](auto&& xs) {
+        hana::unpack(static_cast<decltype(xs)&&>(xs), [](auto const& ...) { });
+    });
+    report("hana::zip", [](auto&& xs) {
+        return hana::zip(static_cast<decltype(xs)&&>(xs));
+    });
+}
@@ -0,0 +1,64 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_COUNTED_HPP
+#define BOOST_HANA_BENCHMARK_COUNTED_HPP
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+
+namespace boost { namespace hana { namespace benchmark {
+    struct counts {
+        long constructions = 0;
+        long copies = 0;
+        long moves = 0;
+        long destructions = 0;
+    };
+
+    inline counts& global_counts() {
+        static counts c;
+        return c;
+    }
+
+    // A std::string that counts the number of times it is constructed,
+    // copied, moved and destroyed.
+    struct counted {
+        std::string value;
+
+        counted() { ++global_counts().constructions; }
+        explicit counted(std::string v) : value(std::move(v))
+        { ++global_counts().constructions; }
+        counted(counted const& other) : value(other.value)
+        { ++global_counts().copies; }
+        counted(counted&& other) : value(std::move(other.value))
+        { ++global_counts().moves; }
+        counted& operator=(counted const& other)
+        { value = other.value; ++global_counts().copies; return *this; }
+        counted& operator=(counted&& other)
+        { value = std::move(other.value); ++global_counts().moves; return *this; }
+        ~counted() { ++global_counts().destructions; }
+    };
+
+    // Runs `f` once and returns the number of constructions, copies, moves
+    // and destructions it performed.
+    template <typename F>
+    counts count_quietly(F f) {
+        global_counts() = counts{};
+        f();
+        return global_counts();
+    }
+
+    // Runs `f` once and prints the number of copies and moves it performed,
+    // in the format expected by `measure.rb`.
+    auto count = [](auto f) {
+        counts c = count_quietly(f);
+        std::cout << "[copies: " << c.copies << "]" << std::endl;
+        std::cout << "[moves: " << c.moves << "]" << std::endl;
+        return c;
+    };
+}}}
+
+#endif
@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/csv.hpp>
+#include <boost/hana/string.hpp>
+
+#include "inputs.hpp"
+#include "measure.hpp"
+#include <cstddef>
+#include <iostream>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct record {
+    BOOST_HANA_DEFINE_STRUCT(record,
+        <%= (0...input_size).map { |c|
+              "(#{['int', 'double', 'std::string'][c % 3]}, c#{c})"
+            }.join(",\n        ") %>
+    );
+};
+
+int main() {
+    std::string const csv = make_csv(<%= input_size %>);
+    std::size_t records = 0;
+
+    float seconds = boost::hana::benchmark::measure([&] {
+        auto columns = hana::experimental::read_csv_columns<record>(csv);
+        records += columns[BOOST_HANA_STRING("c0")].size();
+    });
+    std::cout << "[throughput: " << csv.size() / seconds / 1e6 << " MB/s]" << std::endl;
+    if (records == 0)
+        std::cout << "no records" << std::endl;
+}
@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "inputs.hpp"
+#include "measure.hpp"
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+struct record {
+    <%= (0...input_size).map { |c|
+          "#{['int', 'double', 'std::string'][c % 3]} c#{c};"
+        }.join("\n    ") %>
+};
+
+int main() {
+    std::string const csv = make_csv(<%= input_size %>);
+    std::size_t records = 0;
+
+    float seconds = boost::hana::benchmark::measure([&] {
+        std::vector<record> result;
+        std::istringstream in{csv};
+        std::string line, field;
+        std::getline(in, line);
+        while (std::getline(in, line)) {
+            std::istringstream fields{line};
+            record r;
+            <%= (0...input_size).map { |c|
+                  convert = ['std::stoi(field)', 'std::stod(field)', 'field'][c % 3]
+                  "std::getline(fields, field, ','); r.c#{c} = #{convert};"
+                }.join("\n            ") %>
+            result.push_back(r);
+        }
+        records += result.size();
+    });
+    std::cout << "[throughput: " << csv.size() / seconds / 1e6 << " MB/s]" << std::endl;
+    if (records == 0)
+        std::cout << "no records" << std::endl;
+}
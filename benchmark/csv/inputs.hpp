@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_CSV_INPUTS_HPP
+#define BOOST_HANA_BENCHMARK_CSV_INPUTS_HPP
+
+#include <cstddef>
+#include <random>
+#include <string>
+
+
+// The size of the CSV data read by each repetition of a benchmark. Since
+// `measure` repeats the benchmark 500 times, 2 GB are read in total.
+constexpr std::size_t csv_bytes = 4u << 20;
+
+// CSV data with `columns` columns named c0, c1, ..., whose values are an int,
+// a double and a string in turn. This must be kept in sync with the records
+// declared in the templates.
+inline std::string make_csv(std::size_t columns) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> ints(-100000, 100000);
+    std::uniform_real_distribution<double> doubles(0, 1000);
+    std::uniform_int_distribution<int> word(0, 4);
+    char const* words[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+
+    std::string csv;
+    for (std::size_t c = 0; c != columns; ++c)
+        csv += (c == 0 ? "c" : ",c") + std::to_string(c);
+    csv += '\n';
+    while (csv.size() < csv_bytes) {
+        for (std::size_t c = 0; c != columns; ++c) {
+            if (c != 0)
+                csv += ',';
+            switch (c % 3) {
+                case 0: csv += std::to_string(ints(gen)); break;
+                case 1: csv += std::to_string(doubles(gen)); break;
+                case 2: csv += words[word(gen)]; break;
+            }
+        }
+        csv += '\n';
+    }
+    return csv;
+}
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/concat.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+// This is how hana::cycle is implemented for MonadPlus that are not also
+// Sequences, which is what a naive implementation would do for Sequences.
+template <std::size_t n, bool = n % 2 == 0>
+struct cycle_helper;
+
+template <>
+struct cycle_helper<0, true> {
+    template <typename Xs>
+    static constexpr auto apply(Xs const&) { return hana::make_tuple(); }
+};
+
+template <std::size_t n>
+struct cycle_helper<n, true> {
+    template <typename Xs>
+    static constexpr auto apply(Xs const& xs)
+    { return cycle_helper<n/2>::apply(hana::concat(xs, xs)); }
+};
+
+template <std::size_t n>
+struct cycle_helper<n, false> {
+    template <typename Xs>
+    static constexpr auto apply(Xs const& xs)
+    { return hana::concat(xs, cycle_helper<n-1>::apply(xs)); }
+};
+
+template <int i>
+struct x { };
+
+int main() {
+    auto xs = hana::make_tuple(
+        <%= (1..10).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    auto result = cycle_helper<<%= input_size / 10 %>>::apply(xs);
+    (void)result;
+}
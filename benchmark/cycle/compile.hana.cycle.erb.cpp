@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/cycle.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    auto xs = hana::make_tuple(
+        <%= (1..10).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    auto result = hana::cycle(xs, hana::size_c<<%= input_size / 10 %>>);
+    (void)result;
+}
@@ -0,0 +1,14 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/repeat.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    int count = 0;
+    hana::repeat(hana::size_c<<%= input_size %>>, [&] { ++count; });
+    return count;
+}
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/cycle.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+
+
+int main () {
+    std::string s(64, 'x');
+    auto values = boost::hana::make_tuple(
+        <%= (1..10).map { 's' }.join(', ') %>
+    );
+
+    std::size_t size = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            auto result = boost::hana::cycle(values, boost::hana::size_c<<%= input_size / 10 %>>);
+            boost::hana::for_each(result, [&](std::string const& x) {
+                size += x.size();
+            });
+        }
+        return size;
+    });
+}
@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+
+#include <array>
+
+
+struct f {
+    template <typename State, typename X>
+    constexpr X operator()(State, X x) const { return x; }
+};
+
+struct state { };
+
+int main() {
+    constexpr std::array<int, <%= input_size %>> array = {{
+        <%= (1..input_size).to_a.join(', ') %>
+    }};
+    constexpr auto result = boost::hana::fold_left(array, state{}, f{});
+    (void)result;
+}
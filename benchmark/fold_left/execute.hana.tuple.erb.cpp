@@ -22,5 +22,6 @@ int main () {
                 return state + t;
             });
         }
+        return result;
     });
 }
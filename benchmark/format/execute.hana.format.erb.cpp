@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <cstdio>
+namespace hana = boost::hana;
+
+<%
+  kinds = [:int, :double, :string]
+  fields = (0...input_size).map { |i| [i, kinds[i % 3]] }
+%>
+
+int main() {
+    auto format = hana::experimental::format(BOOST_HANA_STRING(
+        "[info] request done:<%= fields.map { |i, _| " field#{i}={}" }.join %>"
+    ));
+    char const* names[] = {"alice", "bob", "carol", "dave"};
+
+    boost::hana::benchmark::measure([&] {
+        char buffer[4096];
+        std::size_t total = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            total += format(buffer, sizeof(buffer)
+                <%= fields.map { |i, kind|
+                      case kind
+                      when :int then ", std::rand()"
+                      when :double then ", std::rand() / 3.0"
+                      when :string then ", names[std::rand() % 4]"
+                      end
+                    }.join %>
+            );
+        }
+        if (total == 0)
+            std::puts(buffer);
+    });
+}
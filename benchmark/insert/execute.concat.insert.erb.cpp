@@ -0,0 +1,50 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/take_front.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "counted.hpp"
+#include "measure.hpp"
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::benchmark::counted;
+
+// This is how hana::insert used to be implemented for Sequences, which
+// creates several intermediate sequences.
+template <typename Xs, typename N, typename Element>
+auto concat_insert(Xs&& xs, N const& n, Element&& e) {
+    return hana::concat(hana::append(hana::take_front(xs, n),
+                                     static_cast<Element&&>(e)),
+                        hana::drop_front(xs, n));
+}
+
+auto make_input() {
+    return hana::make_tuple(
+        <%= input_size.times.map { |i| "counted{std::string(32, 'a' + #{i % 26})}" }.join(', ') %>
+    );
+}
+
+int main() {
+    hana::benchmark::measure([] {
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            auto xs = make_input();
+            auto result = concat_insert(std::move(xs), hana::size_c<<%= input_size / 2 %>>,
+                                        counted{"inserted"});
+            (void)result;
+        }
+    });
+
+    auto xs = make_input();
+    hana::benchmark::count([&] {
+        auto result = concat_insert(std::move(xs), hana::size_c<<%= input_size / 2 %>>,
+                                        counted{"inserted"});
+        (void)result;
+    });
+}
@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "counted.hpp"
+#include "measure.hpp"
+#include <cstddef>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+using hana::benchmark::counted;
+
+// The indices are reversed so that the general implementation of slice
+// is used, not the one for contiguous ranges.
+<% indices = (0...input_size).to_a.reverse %>
+
+auto make_input() {
+    return hana::make_tuple(
+        <%= input_size.times.map { |i| "counted{std::string(32, 'a' + #{i % 26})}" }.join(', ') %>
+    );
+}
+
+int main() {
+    hana::benchmark::measure([] {
+        for (int iteration = 0; iteration < 1 << 5; ++iteration) {
+            auto xs = make_input();
+            auto result = hana::slice(<%= env[:lvalue] ? 'xs' : 'std::move(xs)' %>,
+                hana::tuple_c<std::size_t<%= indices.map { |i| ", #{i}" }.join %>>);
+            (void)result;
+        }
+    });
+
+    auto xs = make_input();
+    hana::benchmark::count([&] {
+        auto result = hana::slice(<%= env[:lvalue] ? 'xs' : 'std::move(xs)' %>,
+                hana::tuple_c<std::size_t<%= indices.map { |i| ", #{i}" }.join %>>);
+        (void)result;
+    });
+}
@@ -0,0 +1,61 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/tuple.hpp>
+
+// An Iterable which is not a Sequence, whose drop_front copies the remaining
+// elements like most Iterables do.
+struct iterable_tag;
+
+template <typename Storage>
+struct iterable {
+    Storage storage;
+    using hana_tag = iterable_tag;
+};
+
+template <typename Storage>
+constexpr iterable<Storage> make_iterable(Storage s) { return {s}; }
+
+namespace boost { namespace hana {
+    template <>
+    struct at_impl<iterable_tag> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const& n)
+        { return hana::at(static_cast<Xs&&>(xs).storage, n); }
+    };
+
+    template <>
+    struct drop_front_impl<iterable_tag> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const& n)
+        { return make_iterable(hana::drop_front(static_cast<Xs&&>(xs).storage, n)); }
+    };
+
+    template <>
+    struct is_empty_impl<iterable_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return hana::is_empty(xs.storage); }
+    };
+}}
+
+struct is_last {
+    template <typename N>
+    constexpr auto operator()(N) const {
+        return boost::hana::bool_c<N::value == <%= input_size %>>;
+    }
+};
+
+int main() {
+    auto xs = make_iterable(boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_c<#{n}>" }.join(', ') %>
+    ));
+    auto result = boost::hana::any_of(xs, is_last{});
+    (void)result;
+}
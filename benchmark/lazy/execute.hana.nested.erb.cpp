@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/eval.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/lazy.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <cstdio>
+namespace hana = boost::hana;
+
+
+volatile double noise = 0;
+
+template <int i>
+struct step {
+    double operator()(double x) const { return x * 1.0001 + i; }
+};
+
+// This is how `hana::transform` used to represent transforms on lazy values:
+// each step is a lazy call evaluating the previous lazy expression.
+int main() {
+    auto base = hana::make_lazy([](int seed) { return seed / 7.0 + noise; })(std::rand());
+    auto chain = <%= (0...input_size).reduce("base") { |expr, i|
+                       "hana::make_lazy(hana::compose(step<#{i}>{}, hana::eval))(#{expr})"
+                     } %>;
+
+    boost::hana::benchmark::measure([&] {
+        double total = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration)
+            total += hana::eval(chain);
+        if (total == 0)
+            std::puts("empty");
+    });
+}
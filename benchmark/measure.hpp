@@ -5,24 +5,218 @@
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+#endif
 
 
 namespace boost { namespace hana { namespace benchmark {
+    // Makes the compiler believe that `value` is read by code it can't see,
+    // so the computation of `value` can't be optimized away.
+    template <typename T>
+    inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static char const volatile* sink;
+        sink = &reinterpret_cast<char const volatile&>(value);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    // Makes the compiler believe that all of the memory may have been read
+    // and written, so that stores can't be elided or moved across the call.
+    inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    namespace detail {
+        // Hardware counters read around each sample when the
+        // BOOST_HANA_BENCHMARK_COUNTERS environment variable is set. The
+        // counters that can't be opened (no support for `perf_event_open`,
+        // insufficient permissions, unsupported event) are left out.
+        struct perf_counters {
+            static constexpr std::size_t size = 4;
+
+            static char const* name(std::size_t i) {
+                static char const* names[size] = {
+                    "cycles", "instructions", "cache misses", "branch misses"
+                };
+                return names[i];
+            }
+
+            perf_counters() {
+                std::fill(fds, fds + size, -1);
+#ifdef BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+                if (!std::getenv("BOOST_HANA_BENCHMARK_COUNTERS"))
+                    return;
+
+                std::uint64_t configs[size] = {
+                    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+                };
+                for (std::size_t i = 0; i < size; ++i) {
+                    perf_event_attr attr{};
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.size = sizeof(perf_event_attr);
+                    attr.config = configs[i];
+                    attr.disabled = 1;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    fds[i] = static_cast<int>(
+                        ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0)
+                    );
+                }
+#endif
+            }
+
+            perf_counters(perf_counters const&) = delete;
+            perf_counters& operator=(perf_counters const&) = delete;
+
+            ~perf_counters() {
+#ifdef BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+                for (int fd : fds)
+                    if (fd >= 0) ::close(fd);
+#endif
+            }
+
+            bool enabled(std::size_t i) const { return fds[i] >= 0; }
+
+            void start() {
+#ifdef BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+                for (int fd : fds) {
+                    if (fd < 0) continue;
+                    ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+            }
+
+            void stop(std::uint64_t (&values)[size]) {
+                std::fill(values, values + size, 0);
+#ifdef BOOST_HANA_BENCHMARK_HAS_PERF_EVENT
+                for (std::size_t i = 0; i < size; ++i) {
+                    if (fds[i] < 0) continue;
+                    ::ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+                    if (::read(fds[i], &values[i], sizeof values[i]) != sizeof values[i])
+                        values[i] = 0;
+                }
+#endif
+            }
+
+        private:
+            int fds[size];
+        };
+
+        template <typename F>
+        inline void invoke(F& f, std::true_type /* returns void */)
+        { f(); }
+
+        template <typename F>
+        inline void invoke(F& f, std::false_type /* returns void */)
+        { benchmark::do_not_optimize(f()); }
+
+        // Calls `f` `iterations` times and returns the elapsed time in seconds.
+        template <typename F>
+        double run(F& f, std::size_t iterations) {
+            using returns_void = typename std::is_void<decltype(f())>::type;
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; ++i) {
+                detail::invoke(f, returns_void{});
+                benchmark::clobber_memory();
+            }
+            auto stop = std::chrono::steady_clock::now();
+            return std::chrono::duration<double>(stop - start).count();
+        }
+
+        inline double median(std::vector<double> xs) {
+            std::sort(xs.begin(), xs.end());
+            std::size_t n = xs.size();
+            return n % 2 ? xs[n / 2] : (xs[n / 2 - 1] + xs[n / 2]) / 2;
+        }
+
+        // Median absolute deviation, a measure of the spread of the samples
+        // that is not thrown off by a few outliers.
+        inline double mad(std::vector<double> const& xs, double median) {
+            std::vector<double> deviations;
+            for (double x : xs)
+                deviations.push_back(std::abs(x - median));
+            return detail::median(deviations);
+        }
+    }
+
+    // Measures the time taken by a call to `f`, prints the statistics in a
+    // format understood by `measure.rb` and returns the median time in
+    // seconds.
+    //
+    // `f` is first run in batches of growing size until a batch takes at
+    // least `min_sample_time`; this warms up the caches and the branch
+    // predictors, and finds a number of iterations large enough to be
+    // timed precisely. Then, `samples` batches of that size are timed,
+    // and the median and the median absolute deviation of the time per
+    // iteration are reported. If `f` returns something, the result is
+    // passed to `do_not_optimize`.
     auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
-            f();
+        constexpr double min_sample_time = 0.01; // seconds
+        constexpr std::size_t max_iterations = 1ull << 30;
+        constexpr std::size_t samples = 21;
+
+        std::size_t iterations = 1;
+        double time = detail::run(f, iterations);
+        while (time < min_sample_time && iterations < max_iterations) {
+            // Aim a bit above the minimum time, but never grow by more than
+            // a factor of 10 at once since the first batches are imprecise.
+            double factor = time > 0 ? 1.4 * min_sample_time / time : 10;
+            iterations = static_cast<std::size_t>(
+                iterations * std::max(std::min(factor, 10.0), 2.0)
+            );
+            time = detail::run(f, iterations);
+        }
+
+        detail::perf_counters counters;
+        std::vector<double> times;
+        std::vector<double> events[detail::perf_counters::size];
+        for (std::size_t sample = 0; sample < samples; ++sample) {
+            std::uint64_t values[detail::perf_counters::size];
+            counters.start();
+            times.push_back(detail::run(f, iterations) / iterations);
+            counters.stop(values);
+            for (std::size_t i = 0; i < detail::perf_counters::size; ++i)
+                events[i].push_back(static_cast<double>(values[i]) / iterations);
         }
-        auto stop = std::chrono::steady_clock::now();
 
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
+        double median = detail::median(times);
+        std::cout.precision(9);
+        std::cout << "[execution time: " << median << "]" << std::endl;
+        std::cout << "[execution time mad: " << detail::mad(times, median) << "]" << std::endl;
+        std::cout << "[iterations: " << iterations << "]" << std::endl;
+        std::cout << "[samples: " << samples << "]" << std::endl;
+        for (std::size_t i = 0; i < detail::perf_counters::size; ++i) {
+            if (counters.enabled(i)) {
+                std::cout << "[" << detail::perf_counters::name(i) << ": "
+                          << detail::median(events[i]) << "]" << std::endl;
+            }
+        }
+        return static_cast<float>(median);
     };
 }}}
 
@@ -6,8 +6,10 @@
 #
 #
 # When called as a program, this script runs the command line given in
-# arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# arguments and returns the total time and the peak memory usage. This
+# is similar to the `time` command from Bash.
+# The flags in the BOOST_HANA_BENCHMARK_CXXFLAGS environment variable,
+# if any, are appended to the command line.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +18,8 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'fiddle'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -79,7 +83,107 @@ def cmake_bool(b)
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
+# Returns the peak resident memory of the terminated child processes in MB,
+# or 0 if it can't be determined on this platform.
+def children_peak_memory
+  getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  rusage = Fiddle::Pointer.malloc(256)
+  rusage_children = -1
+  return 0 if getrusage.call(rusage_children, rusage) != 0
+
+  # ru_maxrss follows the two `struct timeval`s at the start of `struct rusage`.
+  offset = 2 * 2 * Fiddle::SIZEOF_LONG
+  maxrss = rusage[offset, Fiddle::SIZEOF_LONG].unpack('l!')[0]
+  # ru_maxrss is in bytes on macOS, and in kilobytes elsewhere.
+  maxrss /= 1024 if RUBY_PLATFORM =~ /darwin/
+  maxrss.to_f / 1024
+rescue Fiddle::DLError
+  0
+end
+
+# Statistics printed by the `measure` function of the `measure.hpp` header
+# in addition to the median execution time. The hardware counters are only
+# printed when the BOOST_HANA_BENCHMARK_COUNTERS environment variable is set
+# and the platform supports them.
+EXECUTION_STATISTICS = {
+  mad: 'execution time mad',
+  iterations: 'iterations',
+  samples: 'samples',
+  cycles: 'cycles',
+  instructions: 'instructions',
+  cache_misses: 'cache misses',
+  branch_misses: 'branch misses'
+}
+
+# Returns the name of the function or template in the demangled symbol
+# `name`, with the template arguments, the function parameters and the
+# return type stripped. For example,
+#   auto boost::hana::transform_impl<Tag>::apply<Xs, F>(Xs&&, F&&)
+# becomes
+#   boost::hana::transform_impl<>::apply<>()
+def template_name(name)
+  operators = {}
+  name = name.gsub(/operator(\(\)|<<=?|>>=?|<=|>=|<|>|->\*?)/) { |op|
+    operators["\x01#{operators.size}\x01"] = op
+    "\x01#{operators.size - 1}\x01"
+  }
+  name = name.gsub(/ \[clone [^\]]*\]/, '').gsub(/(\x01\d+\x01) </, '\1<')
+  loop do
+    collapsed = name.gsub(/<[^<>()]*>/, "\x02").gsub(/\([^<>()]*\)/, "\x03")
+    break if collapsed == name
+    name = collapsed
+  end
+  name = name.gsub(/ const(?=::|$)/, '').split(' ').last || ''
+  name = name.gsub("\x02", '<>').gsub("\x03", '()')
+  name.gsub(/\x01\d+\x01/) { |placeholder| operators[placeholder] }
+end
+
+# Returns statistics about the functions defined in the given executable.
+# The functions of Hana are the ones whose name is in the boost::hana
+# namespace, except for the ones of the benchmark harness. This relies on
+# `nm` reporting the size of the symbols, which is the case with ELF files.
+def symbols(executable)
+  nm = -> (*options) {
+    stdout, stderr, status = Open3.capture3("@CMAKE_NM@", "--defined-only",
+                                            "--print-size", "--no-sort",
+                                            *options, executable)
+    raise "nm error: #{stderr}" if not status.success?
+    stdout.lines.map { |line| line.chomp.split(' ', 4) }
+  }
+
+  functions = nm[].zip(nm["--demangle"]).select { |(_, _, type, _), _|
+    "tTwW".include?(type.to_s)
+  }.map { |(_, size, _, mangled), (_, _, _, demangled)|
+    { size: size.to_i(16), mangled: mangled, template: template_name(demangled) }
+  }
+  hana = functions.select { |f|
+    f[:template].start_with?("boost::hana::") &&
+      !f[:template].start_with?("boost::hana::benchmark::")
+  }
+
+  templates = hana.group_by { |f| f[:template] }.map { |template, instances|
+    [template, instances.length, instances.map { |f| f[:size] }.inject(0, :+)]
+  }.sort_by { |_, _, size| -size }
+
+  {
+    functions: functions.length,
+    hana_functions: hana.length,
+    hana_size: hana.map { |f| f[:size] }.inject(0, :+),
+    max_mangled_length: hana.map { |f| f[:mangled].length }.max || 0,
+    total_mangled_length: hana.map { |f| f[:mangled].length }.inject(0, :+),
+    largest_templates: templates.first(5).map { |template, count, size|
+      "#{template} (#{size} bytes, #{count} instantiation#{'s' if count > 1})"
+    }
+  }
+end
+
+# aspect must be one of :compilation_time, :compilation_memory, :bloat,
+# :symbols, :execution_time, :copies, :moves, :counts_per_element
+#
+# The `cxxflags` key of `env` may contain flags to add at the end of the
+# compiler's command line, e.g. to build at a different optimization level.
 def measure(aspect, template_relative, range, env = {})
   measure_file = Pathname.new("#{MEASURE_FILE}")
   template = Pathname.new(template_relative).expand_path
@@ -91,7 +195,8 @@ def measure(aspect, template_relative, range, env = {})
 
   make = -> (target) {
     command = "@CMAKE_COMMAND@ --build @CMAKE_BINARY_DIR@ --target #{target}"
-    stdout, stderr, status = Open3.capture3(command)
+    flags = { "BOOST_HANA_BENCHMARK_CXXFLAGS" => env[:cxxflags] }
+    stdout, stderr, status = Open3.capture3(flags, command)
   }
 
   progress = ProgressBar.create(format: '%p%% %t | %B |',
@@ -110,6 +215,7 @@ def measure(aspect, template_relative, range, env = {})
     stdout, stderr, status = make["#{MEASURE_TARGET}"]
     raise "compilation error: #{stdout}\n\n#{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
+    cmemory = stdout.match(/\[compilation memory: (.+)\]/i)
     # Size of the generated executable in KB
     size = File.size("@CMAKE_CURRENT_BINARY_DIR@/#{MEASURE_TARGET}").to_f / 1000
 
@@ -119,7 +225,11 @@ def measure(aspect, template_relative, range, env = {})
     # this iteration.
     (sleep 0.2; redo) if ctime.nil?
     stat = ctime.captures[0].to_f if aspect == :compilation_time
+    stat = cmemory.captures[0].to_f if aspect == :compilation_memory
     stat = size if aspect == :bloat
+    if aspect == :symbols
+      stat = { size: size }.merge(symbols("@CMAKE_CURRENT_BINARY_DIR@/#{MEASURE_TARGET}"))
+    end
 
     # Run the resulting program and get timing statistics. The statistics
     # should be written to stdout by the `measure` function of the
@@ -133,7 +243,43 @@ def measure(aspect, template_relative, range, env = {})
                "Did you use the `measure` function in the `measure.hpp` header? " +
                "stdout follows:\n#{stdout}")
       end
-      stat = match.captures[0].to_f
+      stat = { time: match.captures[0].to_f }
+      EXECUTION_STATISTICS.each do |key, label|
+        match = stdout.match(/\[#{label}: (.+)\]/i)
+        stat[key] = match.captures[0].to_f unless match.nil?
+      end
+    end
+
+    # Run the resulting program and get the number of copies or moves.
+    # These should be written to stdout by the `count` function of the
+    # `counted.hpp` header.
+    if aspect == :copies or aspect == :moves
+      stdout, stderr, status = make["#{MEASURE_TARGET}.run"]
+      raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
+      match = stdout.match(/\[#{aspect}: (.+)\]/i)
+      if match.nil?
+        raise ("Could not find [#{aspect}: ...] bit in the output. " +
+               "Did you use the `count` function in the `counted.hpp` header? " +
+               "stdout follows:\n#{stdout}")
+      end
+      stat = match.captures[0].to_i
+    end
+
+    # Run the resulting program and get the number of copies and moves per
+    # element made by each of the algorithms it exercises. These should be
+    # written to stdout as `[copies per element: <series>: <value>]` and
+    # `[moves per element: <series>: <value>]`.
+    if aspect == :counts_per_element
+      stdout, stderr, status = make["#{MEASURE_TARGET}.run"]
+      raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
+      stat = { copies: {}, moves: {} }
+      stdout.scan(/\[(copies|moves) per element: (.+): ([^\]]+)\]/) do |kind, series, value|
+        stat[kind.to_sym][series] = value.to_f
+      end
+      if stat.values.all?(&:empty?)
+        raise ("Could not find any [copies per element: ...] bit in the output. " +
+               "stdout follows:\n#{stdout}")
+      end
     end
 
     progress.increment
@@ -144,18 +290,60 @@ ensure
   progress.finish if progress
 end
 
+# Returns a JSON array of points whose `x` is the input size and whose `y` is
+# the median execution time. The other statistics from EXECUTION_STATISTICS
+# are attached to each point, and they are shown in the tooltips.
 def time_execution(erb_file, range, env = {})
-  measure(:execution_time, erb_file, range, env)
+  measure(:execution_time, erb_file, range, env).map { |n, stat|
+    { x: n, y: stat[:time] }.merge(stat.reject { |key, _| key == :time })
+  }.to_json
+end
+
+# Returns a JSON array of points whose `x` is the input size and whose `y` is
+# the `key` statistic of the executable, as returned by `symbols` (or `:size`
+# for the size of the executable in KB). The other statistics are attached
+# to each point, and they are shown in the tooltips.
+def measure_symbols(key, erb_file, range, env = {})
+  measure(:symbols, erb_file, range, env).map { |n, stat|
+    { x: n, y: stat[key] }.merge(stat.reject { |k, _| k == key })
+  }.to_json
 end
 
 def time_compilation(erb_file, range, env = {})
   measure(:compilation_time, erb_file, range, env)
 end
 
+def count_copies(erb_file, range, env = {})
+  measure(:copies, erb_file, range, env)
+end
+
+def count_moves(erb_file, range, env = {})
+  measure(:moves, erb_file, range, env)
+end
+
+# Returns a Hash with the :copies and :moves keys. Each maps the name of a
+# series printed by the program to its data, i.e. a list of [n, value] pairs.
+def count_per_element(erb_file, range, env = {})
+  result = { copies: {}, moves: {} }
+  measure(:counts_per_element, erb_file, range, env).each do |n, stat|
+    stat.each do |kind, series|
+      series.each { |name, value| (result[kind][name] ||= []) << [n, value] }
+    end
+  end
+  result
+end
+
+# Turns a Hash mapping series names to their data into a JSON array of series.
+def chart_series(series)
+  series.map { |name, data| { name: name, data: data } }.to_json
+end
+
 if __FILE__ == $0
   command = ARGV.join(' ')
+  command += " #{ENV['BOOST_HANA_BENCHMARK_CXXFLAGS']}" if ENV['BOOST_HANA_BENCHMARK_CXXFLAGS']
   time = Benchmark.realtime { `#{command}` }
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+  puts "[compilation memory: #{children_peak_memory}]"
 end
@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+namespace hana = boost::hana;
+
+
+// A stage of a pipeline handling messages of type `Message`, whose work
+// is CPU-bound and independent from the other stages.
+template <typename Message>
+struct stage {
+    std::size_t checksum = 0;
+
+    void operator()() {
+        for (std::size_t i = 0; i != 1 << 18; ++i)
+            checksum = checksum * 31 + static_cast<std::size_t>(Message(i) * Message(3));
+    }
+};
+
+int main() {
+    auto stages = hana::make_tuple(
+        stage<char>{}, stage<short>{}, stage<int>{}, stage<long>{},
+        stage<unsigned>{}, stage<float>{}, stage<double>{}, stage<long double>{}
+    );
+
+    boost::hana::benchmark::measure([&] {
+        hana::for_each(stages, [](auto& stage) {
+            stage();
+        });
+    });
+
+    std::size_t total = 0;
+    hana::for_each(stages, [&](auto const& stage) { total += stage.checksum; });
+    if (total == 0)
+        std::puts("no work was done");
+}
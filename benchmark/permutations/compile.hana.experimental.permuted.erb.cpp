@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+<%
+  factorial = (1..input_size).reduce(1, :*)
+%>
+
+int main() {
+    int count = 0;
+    auto xs = hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    // A few permutations spread over all of them.
+    <% (0...8).map { |k| k * (factorial - 1) / 7 }.uniq.each do |k| %>
+        hana::for_each(hana::experimental::permuted(xs, hana::size_c<<%= k %>>),
+                       [&](auto const&) { ++count; });
+    <% end %>
+    return count;
+}
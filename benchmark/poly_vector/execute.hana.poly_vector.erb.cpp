@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/poly_vector.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+namespace hana = boost::hana;
+
+
+// A message handler; each of the `i`s is a distinct type.
+template <int i>
+struct handler {
+    std::size_t value;
+
+    void handle(std::size_t& checksum) const
+    { checksum = checksum * 31 + value + i; }
+};
+
+int main() {
+    hana::experimental::poly_vector<
+        <%= (0...input_size).map { |i| "handler<#{i}>" }.join(', ') %>
+    > handlers;
+
+    for (std::size_t n = 0; n < 1000000; n += <%= input_size %>) {
+        <% (0...input_size).each do |i| %>
+            handlers.insert(handler<<%= i %>>{n + <%= i %>});
+        <% end %>
+    }
+
+    std::size_t checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        handlers.for_each([&](auto const& h) {
+            h.handle(checksum);
+        });
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+
+struct base {
+    virtual void handle(std::size_t& checksum) const = 0;
+    virtual ~base() = default;
+};
+
+// A message handler; each of the `i`s is a distinct type.
+template <int i>
+struct handler : base {
+    explicit handler(std::size_t value) : value(value) { }
+    std::size_t value;
+
+    void handle(std::size_t& checksum) const override
+    { checksum = checksum * 31 + value + i; }
+};
+
+int main() {
+    std::vector<std::unique_ptr<base>> handlers;
+
+    for (std::size_t n = 0; n < 1000000; n += <%= input_size %>) {
+        <% (0...input_size).each do |i| %>
+            handlers.push_back(std::make_unique<handler<<%= i %>>>(n + <%= i %>));
+        <% end %>
+    }
+
+    std::size_t checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& h : handlers)
+            h->handle(checksum);
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
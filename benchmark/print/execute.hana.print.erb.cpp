@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/printable.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <cstdio>
+#include <sstream>
+namespace hana = boost::hana;
+
+<%
+  kinds = [:int, :optional, :pair, :type]
+  fields = (0...input_size).map { |i| kinds[i % kinds.size] }
+%>
+
+int main() {
+    char const* names[] = {"alice", "bob", "carol", "dave"};
+
+    boost::hana::benchmark::measure([&] {
+        std::ostringstream ss;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto record = hana::make_tuple(
+                <%= fields.map { |kind|
+                      case kind
+                      when :int then "std::rand()"
+                      when :optional then "hana::just(std::rand() / 3.0)"
+                      when :pair then "hana::make_pair(names[std::rand() % 4], std::rand())"
+                      when :type then "hana::type_c<int>"
+                      end
+                    }.join(', ') %>
+            );
+            ss.str("");
+            ss << hana::experimental::print(record);
+        }
+        if (ss.str().empty())
+            std::puts("empty record");
+    });
+}
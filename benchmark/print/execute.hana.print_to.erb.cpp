@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <cstdio>
+namespace hana = boost::hana;
+
+<%
+  kinds = [:int, :optional, :pair, :type]
+  fields = (0...input_size).map { |i| kinds[i % kinds.size] }
+%>
+
+int main() {
+    char const* names[] = {"alice", "bob", "carol", "dave"};
+
+    boost::hana::benchmark::measure([&] {
+        char buffer[4096];
+        std::size_t total = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            auto record = hana::make_tuple(
+                <%= fields.map { |kind|
+                      case kind
+                      when :int then "std::rand()"
+                      when :optional then "hana::just(std::rand() / 3.0)"
+                      when :pair then "hana::make_pair(names[std::rand() % 4], std::rand())"
+                      when :type then "hana::type_c<int>"
+                      end
+                    }.join(', ') %>
+            );
+            total += hana::experimental::print_to(buffer, sizeof(buffer), record);
+        }
+        if (total == 0)
+            std::puts(buffer);
+    });
+}
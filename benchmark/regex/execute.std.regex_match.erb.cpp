@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "regex/inputs.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+
+int main() {
+<% if env[:pattern] == :identifier %>
+    std::regex re{"[a-zA-Z_][a-zA-Z0-9_]*"};
+    std::vector<std::string> inputs = identifiers(<%= input_size %>);
+<% else %>
+    std::regex re{"[a-z]+=\\d+(,[a-z]+=\\d+)*"};
+    std::vector<std::string> inputs = lists(<%= input_size %>);
+<% end %>
+
+    std::size_t matched = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::string const& s : inputs)
+            matched += std::regex_match(s, re);
+    });
+
+    if (matched == 0)
+        std::puts("nothing was matched");
+}
@@ -0,0 +1,49 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_REGEX_INPUTS_HPP
+#define BOOST_HANA_BENCHMARK_REGEX_INPUTS_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+// Strings matching `[a-zA-Z_][a-zA-Z0-9_]*`, except for one in 8 which
+// contains an invalid character.
+inline std::vector<std::string> identifiers(std::size_t length) {
+    char const first[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+    char const rest[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+    std::vector<std::string> result(10000);
+    for (std::string& s : result) {
+        s += first[std::rand() % (sizeof(first) - 1)];
+        while (s.size() < length)
+            s += rest[std::rand() % (sizeof(rest) - 1)];
+        if (std::rand() % 8 == 0)
+            s[std::rand() % length] = '-';
+    }
+    return result;
+}
+
+// Strings matching `[a-z]+=\d+(,[a-z]+=\d+)*`, except for one in 8 which
+// contains an invalid character.
+inline std::vector<std::string> lists(std::size_t length) {
+    std::vector<std::string> result(10000);
+    for (std::string& s : result) {
+        while (s.size() < length) {
+            if (!s.empty())
+                s += ',';
+            s += static_cast<char>('a' + std::rand() % 26);
+            s += static_cast<char>('a' + std::rand() % 26);
+            s += '=';
+            s += static_cast<char>('0' + std::rand() % 10);
+        }
+        if (std::rand() % 8 == 0)
+            s[std::rand() % s.size()] = ' ';
+    }
+    return result;
+}
+
+#endif // !BOOST_HANA_BENCHMARK_REGEX_INPUTS_HPP
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/sorting_network.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+using T = <%= env[:type] %>;
+constexpr std::size_t N = <%= input_size %>;
+
+int main() {
+    std::vector<std::array<T, N>> inputs(8192);
+    for (auto& xs : inputs)
+        for (auto& x : xs)
+            x = static_cast<T>(std::rand() % 10000);
+
+    double checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::array<T, N> xs : inputs) {
+            boost::hana::experimental::sorting_network<N>::sort(xs);
+            checksum += xs[N / 2];
+        }
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
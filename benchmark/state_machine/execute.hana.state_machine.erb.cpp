@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include "state_machine/inputs.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::size_t actions = 0;
+    auto count = [&] { ++actions; };
+    auto machine = hana::experimental::make_state_machine(hana::int_c<0>, hana::make_tuple(
+        <%= (0...input_size).to_a.product((0...4).to_a).map { |s, e|
+              "hana::experimental::transition(hana::int_c<#{s}>, hana::int_c<#{e}>, count, hana::int_c<#{(s + e + 1) % input_size}>)"
+            }.join(",\n        ") %>
+    ));
+
+    std::vector<int> inputs = random_events();
+    std::size_t taken = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int e : inputs)
+            taken += machine.process(e);
+    });
+
+    if (taken != actions || machine.state() == 1000)
+        std::puts("the state machine is inconsistent");
+}
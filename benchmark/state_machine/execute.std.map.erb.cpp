@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "state_machine/inputs.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+int main() {
+    std::size_t actions = 0;
+    std::function<void()> count = [&] { ++actions; };
+    std::map<std::pair<int, int>, std::pair<std::function<void()>, int>> transitions;
+    for (int s = 0; s != <%= input_size %>; ++s)
+        for (int e = 0; e != events; ++e)
+            transitions[{s, e}] = {count, (s + e + 1) % <%= input_size %>};
+
+    int state = 0;
+    auto process = [&](int e) {
+        auto it = transitions.find({state, e});
+        if (it == transitions.end())
+            return false;
+        it->second.first();
+        state = it->second.second;
+        return true;
+    };
+
+    std::vector<int> inputs = random_events();
+    std::size_t taken = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int e : inputs)
+            taken += process(e);
+    });
+
+    if (taken != actions || state == 1000)
+        std::puts("the state machine is inconsistent");
+}
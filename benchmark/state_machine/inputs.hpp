@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_STATE_MACHINE_INPUTS_HPP
+#define BOOST_HANA_BENCHMARK_STATE_MACHINE_INPUTS_HPP
+
+#include <random>
+#include <vector>
+
+
+// The state machines have 4 events, and the event `e` moves from the state
+// `s` to the state `(s + e + 1) % states`. One event in 8 has no transition
+// and is ignored.
+constexpr int events = 4;
+
+inline std::vector<int> random_events() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 2 * events - 1);
+    std::vector<int> result(1000000);
+    for (int& e : result) {
+        int x = dist(gen);
+        e = x == 2 * events - 1 ? events : x % events;
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "../example/cppcon_2014/matrix/det.hpp"
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+int main() {
+    std::vector<int> inputs(<%= input_size * input_size %> * 1024);
+    for (auto& x : inputs)
+        x = std::rand() % 7 - 3;
+
+    long checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n != inputs.size(); n += <%= input_size * input_size %>) {
+            int const* x = &inputs[n];
+            auto m = cppcon::matrix(
+                <%= (0...input_size).map { |i|
+                      "cppcon::row(" + (0...input_size).map { |j| "x[#{i * input_size + j}]" }.join(', ') + ")"
+                    }.join(",\n                ") %>
+            );
+            checksum += cppcon::det(m);
+        }
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/static_matrix.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+int main() {
+    std::vector<int> inputs(<%= input_size * input_size %> * 1024);
+    for (auto& x : inputs)
+        x = std::rand() % 7 - 3;
+
+    long checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n != inputs.size(); n += <%= input_size * input_size %>) {
+            int const* x = &inputs[n];
+            boost::hana::experimental::static_matrix<int, <%= input_size %>, <%= input_size %>> m{{
+                <%= (0...input_size * input_size).map { |i| "x[#{i}]" }.join(', ') %>
+            }};
+            checksum += boost::hana::experimental::determinant(m);
+        }
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/mult.hpp>
+
+#include "../example/cppcon_2014/matrix/ring.hpp"
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+int main() {
+    std::vector<int> inputs(<%= input_size * input_size %> * 1024);
+    for (auto& x : inputs)
+        x = std::rand() % 100;
+
+    std::vector<int> outputs(inputs.size());
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n + <%= 2 * input_size * input_size %> <= inputs.size(); n += <%= input_size * input_size %>) {
+            int const* x = &inputs[n];
+            int const* y = &inputs[n + <%= input_size * input_size %>];
+            int* out = &outputs[n];
+            auto a = cppcon::matrix(
+                <%= (0...input_size).map { |i|
+                      "cppcon::row(" + (0...input_size).map { |j| "x[#{i * input_size + j}]" }.join(', ') + ")"
+                    }.join(",\n                ") %>
+            );
+            auto b = cppcon::matrix(
+                <%= (0...input_size).map { |i|
+                      "cppcon::row(" + (0...input_size).map { |j| "y[#{i * input_size + j}]" }.join(', ') + ")"
+                    }.join(",\n                ") %>
+            );
+            auto c = boost::hana::mult(a, b);
+            <%= (0...input_size * input_size).map { |i|
+                  "out[#{i}] = c.at(boost::hana::size_c<#{i / input_size}>, boost::hana::size_c<#{i % input_size}>);"
+                }.join("\n            ") %>
+        }
+    });
+
+    if (outputs[0] == -1)
+        std::puts("unexpected result");
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/static_matrix.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+using matrix = boost::hana::experimental::static_matrix<
+    int, <%= input_size %>, <%= input_size %>
+>;
+
+int main() {
+    std::vector<int> inputs(<%= input_size * input_size %> * 1024);
+    for (auto& x : inputs)
+        x = std::rand() % 100;
+
+    std::vector<int> outputs(inputs.size());
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n + <%= 2 * input_size * input_size %> <= inputs.size(); n += <%= input_size * input_size %>) {
+            int const* x = &inputs[n];
+            int const* y = &inputs[n + <%= input_size * input_size %>];
+            int* out = &outputs[n];
+            matrix a{{<%= (0...input_size * input_size).map { |i| "x[#{i}]" }.join(', ') %>}};
+            matrix b{{<%= (0...input_size * input_size).map { |i| "y[#{i}]" }.join(', ') %>}};
+            matrix c = a * b;
+            <%= (0...input_size * input_size).map { |i|
+                  "out[#{i}] = c(#{i / input_size}, #{i % input_size});"
+                }.join("\n            ") %>
+        }
+    });
+
+    if (outputs[0] == -1)
+        std::puts("unexpected result");
+}
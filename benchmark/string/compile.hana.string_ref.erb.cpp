@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cstdio>
+namespace hana = boost::hana;
+
+<% text = (0...input_size).map { |i| ('a'.ord + i % 26).chr }.join %>
+
+int main() {
+    auto s1 = BOOST_HANA_STRING_REF("<%= text %>");
+    auto s2 = BOOST_HANA_STRING_REF("<%= text %>!");
+    auto eq = hana::equal(s1, s2);
+    auto lt = hana::less(s1, s2);
+    std::puts(s1.c_str());
+    std::puts(s2.c_str());
+    return eq || !lt;
+}
@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstdio>
+namespace hana = boost::hana;
+
+<%
+  half = (0...input_size / 2).map { |i| ('a'.ord + i % 26).chr }.join
+%>
+
+int main() {
+    auto s = BOOST_HANA_STRING("<%= half %>/<%= half %>");
+    auto pieces = hana::experimental::split(s, BOOST_HANA_STRING("/"));
+    std::puts(pieces[hana::size_c<0>].c_str());
+    std::puts(pieces[hana::size_c<1>].c_str());
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/drop_while.hpp>
+#include <boost/hana/not_equal.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/take_while.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstdio>
+namespace hana = boost::hana;
+
+<%
+  half = (0...input_size / 2).map { |i| ('a'.ord + i % 26).chr }.join
+%>
+
+int main() {
+    auto s = BOOST_HANA_STRING("<%= half %>/<%= half %>");
+    auto not_slash = hana::not_equal.to(hana::char_c<'/'>);
+    auto before = hana::unpack(hana::take_while(hana::to_tuple(s), not_slash),
+                               hana::make_string);
+    auto after = hana::drop_front(hana::drop_while(s, not_slash));
+    std::puts(before.c_str());
+    std::puts(after.c_str());
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/trie.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include "trie/inputs.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+<%
+  route = lambda { |i| "/#{%w(api static users admin assets)[i % 5]}/v#{i % 3}/r#{i}" }
+%>
+
+int main() {
+    std::vector<std::size_t> hits(<%= input_size %>);
+    auto routes = hana::experimental::make_trie(hana::make_tuple(
+        <%= (0...input_size).map { |i|
+              "hana::make_pair(BOOST_HANA_STRING(\"#{route.(i)}\"), counter{&hits[#{i}]})"
+            }.join(",\n        ") %>
+    ));
+
+    std::vector<std::string> inputs = requests(<%= input_size %>);
+    std::size_t matched = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::string const& s : inputs)
+            matched += routes.dispatch(s);
+    });
+
+    if (matched == 0)
+        std::puts("nothing was matched");
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "trie/inputs.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+int main() {
+    std::vector<std::size_t> hits(<%= input_size %>);
+    std::vector<std::pair<std::string, counter>> routes;
+    for (std::size_t i = 0; i != <%= input_size %>; ++i)
+        routes.emplace_back(route(i), counter{&hits[i]});
+
+    auto dispatch = [&](std::string const& s) {
+        counter const* best = nullptr;
+        std::size_t longest = 0;
+        for (auto const& r : routes) {
+            if (r.first.size() >= longest && s.compare(0, r.first.size(), r.first) == 0) {
+                best = &r.second;
+                longest = r.first.size();
+            }
+        }
+        if (best == nullptr)
+            return false;
+        (*best)();
+        return true;
+    };
+
+    std::vector<std::string> inputs = requests(<%= input_size %>);
+    std::size_t matched = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::string const& s : inputs)
+            matched += dispatch(s);
+    });
+
+    if (matched == 0)
+        std::puts("nothing was matched");
+}
@@ -0,0 +1,50 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "trie/inputs.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+int main() {
+    std::vector<std::size_t> hits(<%= input_size %>);
+    std::unordered_map<std::string, counter> routes;
+    std::set<std::size_t, std::greater<std::size_t>> lengths;
+    for (std::size_t i = 0; i != <%= input_size %>; ++i) {
+        routes.emplace(route(i), counter{&hits[i]});
+        lengths.insert(route(i).size());
+    }
+
+    // Each prefix of the input whose length is the length of a route is
+    // looked up, from the longest to the shortest.
+    auto dispatch = [&](std::string const& s) {
+        for (std::size_t n : lengths) {
+            if (n > s.size())
+                continue;
+            auto it = routes.find(s.substr(0, n));
+            if (it != routes.end()) {
+                it->second();
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<std::string> inputs = requests(<%= input_size %>);
+    std::size_t matched = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::string const& s : inputs)
+            matched += dispatch(s);
+    });
+
+    if (matched == 0)
+        std::puts("nothing was matched");
+}
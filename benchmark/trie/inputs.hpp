@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_TRIE_INPUTS_HPP
+#define BOOST_HANA_BENCHMARK_TRIE_INPUTS_HPP
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// The i-th route. This must be kept in sync with `route` in the templates.
+inline std::string route(std::size_t i) {
+    char const* prefixes[] = {"api", "static", "users", "admin", "assets"};
+    return "/" + std::string{prefixes[i % 5]} + "/v" + std::to_string(i % 3) +
+           "/r" + std::to_string(i);
+}
+
+// Requests for one of the first `n` routes, followed by a path and a query,
+// and one request in 8 that does not match any route.
+inline std::vector<std::string> requests(std::size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> which(0, n - 1);
+    std::uniform_int_distribution<int> miss(0, 7);
+    std::vector<std::string> result(100000);
+    for (std::string& s : result) {
+        s = miss(gen) == 0 ? "/unknown" : route(which(gen));
+        s += "/item?id=1";
+    }
+    return result;
+}
+
+struct counter {
+    std::size_t* hits;
+    void operator()() const { ++*hits; }
+};
+
+#endif
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "trivially_copyable/records.hpp"
+#include <cstdio>
+
+
+using Record = <%= env[:type] %>;
+
+// The calls are not inlined, so that the records are passed and returned
+// according to the calling convention. Trivially copyable records are passed
+// in registers; other records are passed in memory.
+#if defined(__GNUC__)
+__attribute__((noinline))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+Record step(Record p, int i) {
+    return make_record<Record>(second(p), first(p) + i);
+}
+
+int main() {
+    Record p = make_record<Record>(0, 1);
+    boost::hana::benchmark::measure([&] {
+        for (int repeat = 0; repeat != <%= 1000000 / input_size %>; ++repeat)
+            for (int i = 0; i != <%= input_size %>; ++i)
+                p = step(p, i);
+    });
+
+    if (first(p) == 0 && second(p) == 0)
+        std::puts("the record is 0");
+}
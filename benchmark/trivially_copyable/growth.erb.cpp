@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include "trivially_copyable/records.hpp"
+#include <cstdio>
+#include <vector>
+
+
+int main() {
+    using Record = <%= env[:type] %>;
+    long long checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int repeat = 0; repeat != <%= 1000000 / input_size %>; ++repeat) {
+            std::vector<Record> v;
+            for (int i = 0; i != <%= input_size %>; ++i)
+                v.push_back(make_record<Record>(i, repeat));
+            checksum += first(v.back()) + second(v.front());
+        }
+    });
+
+    if (checksum == 0)
+        std::puts("the checksum is 0");
+}
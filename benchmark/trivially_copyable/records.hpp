@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_TRIVIALLY_COPYABLE_RECORDS_HPP
+#define BOOST_HANA_BENCHMARK_TRIVIALLY_COPYABLE_RECORDS_HPP
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+
+
+// Records of two `int`s, which are all trivially copyable. Each record
+// is created with `Record{x, y}` and read with `first` and `second`.
+
+struct plain_record {
+    int first;
+    int second;
+};
+
+inline int first(plain_record const& r) { return r.first; }
+inline int second(plain_record const& r) { return r.second; }
+
+
+using pair_record = boost::hana::pair<int, int>;
+
+inline int first(pair_record const& r) { return boost::hana::first(r); }
+inline int second(pair_record const& r) { return boost::hana::second(r); }
+
+
+using map_record = decltype(boost::hana::make_map(
+    boost::hana::make_pair(boost::hana::int_c<0>, 0),
+    boost::hana::make_pair(boost::hana::int_c<1>, 0)
+));
+
+inline int first(map_record const& r) { return r[boost::hana::int_c<0>]; }
+inline int second(map_record const& r) { return r[boost::hana::int_c<1>]; }
+
+template <typename Record>
+Record make_record(int x, int y) { return Record{x, y}; }
+
+template <>
+inline map_record make_record<map_record>(int x, int y) {
+    return boost::hana::make_map(
+        boost::hana::make_pair(boost::hana::int_c<0>, x),
+        boost::hana::make_pair(boost::hana::int_c<1>, y)
+    );
+}
+
+#endif
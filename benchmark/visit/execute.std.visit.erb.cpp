@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <variant>
+#include <vector>
+
+
+// The work done for each alternative depends on its type, so the compiler
+// can't merge the code for all the alternatives.
+template <int i>
+struct x {
+    int value;
+    std::size_t get() const { return static_cast<std::size_t>(value) * (i + 1) ^ i; }
+};
+
+using variant = std::variant<
+    x<0>, x<1>, x<2>, x<3>, x<4>, x<5>, x<6>, x<7>
+>;
+
+template <int i>
+variant make(int value) { return x<i>{value}; }
+
+int main() {
+    constexpr variant (*makers[])(int) = {
+        make<0>, make<1>, make<2>, make<3>, make<4>, make<5>, make<6>, make<7>
+    };
+
+    std::vector<variant> variants;
+    for (std::size_t n = 0; n != 1 << 16; ++n)
+        variants.push_back(makers[std::rand() % 8](std::rand()));
+
+    std::size_t checksum = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t n = 0; n + <%= input_size %> <= variants.size(); ++n) {
+            checksum += std::visit([](auto const& ...xs) {
+                return (xs.get() + ...);
+            }, <%= (0...input_size).map { |i| "variants[n + #{i}]" }.join(', ') %>);
+        }
+    });
+
+    if (checksum == 0)
+        std::puts("no work was done");
+}
@@ -63,6 +63,45 @@
     options.tooltip = options.tooltip || {};
     options.tooltip.valueSuffix = options.tooltip.valueSuffix || 's';
 
+    // Show the statistics recorded along with each point, when there are
+    // some: the spread of the samples and the hardware counters for the
+    // execution times, and the symbols of the executables for the sizes.
+    var statistics = {
+        mad: 'MAD'
+      , cycles: 'cycles'
+      , instructions: 'instructions'
+      , cache_misses: 'cache misses'
+      , branch_misses: 'branch misses'
+      , size: 'executable size (kb)'
+      , functions: 'functions'
+      , hana_functions: 'Hana functions'
+      , hana_size: 'size of Hana functions (bytes)'
+      , max_mangled_length: 'longest mangled name'
+      , total_mangled_length: 'total length of mangled names'
+      , largest_templates: 'largest templates'
+    };
+    var escape = function(text) {
+      return String(text).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+    };
+    if (options.tooltip.pointFormatter == undefined) {
+      options.tooltip.pointFormatter = function() {
+        var point = this;
+        var text = '<span style="color:' + point.color + '">\u25CF</span> ' +
+                   point.series.name + ': <b>' + point.y +
+                   options.tooltip.valueSuffix + '</b>';
+        Object.keys(statistics).forEach(function(key) {
+          if (point[key] === undefined)
+            return;
+          text += '<br/>' + statistics[key] + ': ';
+          if (point[key] instanceof Array)
+            text += point[key].map(function(x) { return '<br/>  ' + escape(x); }).join('');
+          else
+            text += escape(point[key]);
+        });
+        return text + '<br/>';
+      };
+    }
+
     if (options.legend == undefined) {
       options.legend = {
         layout: 'vertical',
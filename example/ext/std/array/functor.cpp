@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <array>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::array<int, 3> a = {{1, 2, 3}};
+
+    auto b = hana::transform(a, [](int i) { return std::to_string(i); });
+
+    BOOST_HANA_RUNTIME_CHECK(b == std::array<std::string, 3>{{"1", "2", "3"}});
+}
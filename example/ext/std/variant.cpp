@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/variant.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <string>
+#include <variant>
+namespace hana = boost::hana;
+
+
+struct Fish { std::string name; };
+struct Cat  { std::string name; };
+struct Dog  { std::string name; };
+
+std::string meet(Fish const&, Fish const&) { return "blub"; }
+std::string meet(Cat const&, Dog const&) { return "hiss"; }
+std::string meet(Dog const&, Cat const&) { return "woof"; }
+template <typename A, typename B>
+std::string meet(A const&, B const&) { return "..."; }
+
+int main() {
+    std::variant<Fish, Cat, Dog> a{Cat{"Garfield"}};
+    std::variant<Fish, Cat, Dog> b{Dog{"Snoopy"}};
+
+    std::string said = hana::visit([](auto const& x, auto const& y) {
+        return meet(x, y);
+    }, a, b);
+    BOOST_HANA_RUNTIME_CHECK(said == "hiss");
+
+    std::string name;
+    hana::for_each(b, [&](auto const& animal) { name = animal.name; });
+    BOOST_HANA_RUNTIME_CHECK(name == "Snoopy");
+}
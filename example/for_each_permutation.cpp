@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::ostringstream ss;
+    hana::for_each_permutation(hana::make_tuple('a', 2, "c"), [&](auto const& p) {
+        hana::unpack(p, [&](auto const& x, auto const& y, auto const& z) {
+            ss << x << y << z << ' ';
+        });
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(ss.str() == "a2c ac2 2ac 2ca ca2 c2a ");
+}
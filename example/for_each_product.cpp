@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::ostringstream ss;
+    hana::for_each_product(hana::make_tuple(
+        hana::make_tuple(1, 'a'),
+        hana::make_tuple("b", 2.5)
+    ), [&](auto const& p) {
+        hana::unpack(p, [&](auto const& x, auto const& y) {
+            ss << x << y << ' ';
+        });
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(ss.str() == "1b 12.5 ab a2.5 ");
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    int parses = 0;
+    auto parse_config = [&](std::string const& path) {
+        ++parses;
+        return path + ".parsed";
+    };
+
+    auto config = hana::memoize(hana::make_lazy(parse_config)("app.cfg"));
+    auto size = hana::transform(config, [](std::string const& c) { return c.size(); });
+    BOOST_HANA_RUNTIME_CHECK(parses == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(hana::eval(config) == "app.cfg.parsed");
+    BOOST_HANA_RUNTIME_CHECK(hana::eval(size) == 14);
+    BOOST_HANA_RUNTIME_CHECK(hana::eval(config) == "app.cfg.parsed");
+    BOOST_HANA_RUNTIME_CHECK(parses == 1);
+}
@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+namespace hana = boost::hana;
+
+
+// A string_ref can be keyed by any type with a static constexpr get()
+// returning a string literal or a static constexpr character array.
+struct query {
+    static constexpr decltype(auto) get() {
+        return "SELECT name, email FROM users WHERE id = ?";
+    }
+};
+
+constexpr auto sql = hana::string_ref_c<query>;
+static_assert(sql.size() == 42, "");
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::length(sql) == hana::size_c<42>);
+    BOOST_HANA_CONSTANT_CHECK(
+        BOOST_HANA_STRING_REF("abc") < BOOST_HANA_STRING_REF("abd")
+    );
+    BOOST_HANA_CONSTANT_CHECK(
+        BOOST_HANA_STRING_REF("ab") + BOOST_HANA_STRING_REF("cd") ==
+        BOOST_HANA_STRING_REF("abcd")
+    );
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::to<hana::string_tag>(BOOST_HANA_STRING_REF("ab")) ==
+        BOOST_HANA_STRING("ab")
+    );
+}
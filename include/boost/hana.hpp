@@ -108,6 +108,8 @@ namespace boost {
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fold_right.hpp>
 #include <boost/hana/for_each.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/for_each_permutation.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional.hpp>
 #include <boost/hana/fuse.hpp>
@@ -180,6 +182,7 @@ namespace boost {
 #include <boost/hana/sort.hpp>
 #include <boost/hana/span.hpp>
 #include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
 #include <boost/hana/suffix.hpp>
 #include <boost/hana/sum.hpp>
 #include <boost/hana/symmetric_difference.hpp>
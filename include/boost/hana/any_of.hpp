@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/iterable_cursor.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
@@ -136,11 +137,13 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto lazy_any_of_helper(hana::true_, Cond cond, Xs&&, Pred&&)
         { return cond; }
 
+        // We iterate over a cursor to avoid creating a new Iterable each
+        // time we call `drop_front`.
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&& pred) {
             constexpr bool done = decltype(hana::is_empty(xs))::value;
             return lazy_any_of_helper(hana::bool_c<done>, hana::false_c,
-                                      static_cast<Xs&&>(xs),
+                                      detail::make_iterable_cursor(xs),
                                       static_cast<Pred&&>(pred));
         }
     };
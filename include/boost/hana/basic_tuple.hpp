@@ -39,8 +39,6 @@ BOOST_HANA_NAMESPACE_BEGIN
         //////////////////////////////////////////////////////////////////////
         template <std::size_t> struct bti; // basic_tuple_index
 
-        struct from_other { };
-
         template <typename Indices, typename ...Xn>
 #ifdef BOOST_HANA_WORKAROUND_MSVC_EMPTYBASE
         struct __declspec(empty_bases) basic_tuple_impl;
@@ -60,16 +58,19 @@ BOOST_HANA_NAMESPACE_BEGIN
 
             constexpr basic_tuple_impl() = default;
 
-            template <typename Other>
-            explicit constexpr basic_tuple_impl(detail::from_other, Other&& other)
-                : detail::ebo<bti<n>, Xn>(detail::ebo_get<bti<n>>(static_cast<Other&&>(other)))...
-            { }
-
             template <typename ...Yn>
-            explicit constexpr basic_tuple_impl(Yn&& ...yn)
-                : detail::ebo<bti<n>, Xn>(static_cast<Yn&&>(yn))...
+            constexpr basic_tuple_impl(detail::ebo_init, Yn&& ...yn)
+                : detail::ebo<bti<n>, Xn>(detail::ebo_init{}, static_cast<Yn&&>(yn))...
             { }
         };
+
+        template <typename Tuple, typename ...Yn>
+        struct is_same_tuple : std::false_type { };
+
+        template <typename Tuple>
+        struct is_same_tuple<typename detail::decay<Tuple>::type, Tuple>
+            : std::true_type
+        { };
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -84,17 +85,14 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         constexpr basic_tuple() = default;
 
-        // copy constructor
-        template <typename Other, typename = typename std::enable_if<
-            std::is_same<typename detail::decay<Other>::type, basic_tuple>::value
+        // The copy and move constructors are the implicit ones, which are
+        // trivial when those of the elements are. The constructor below
+        // must not compete with them, even for non-const lvalues.
+        template <typename ...Yn, typename = typename std::enable_if<
+            !detail::is_same_tuple<basic_tuple, Yn...>::value
         >::type>
-        constexpr basic_tuple(Other&& other)
-            : Base(detail::from_other{}, static_cast<Other&&>(other))
-        { }
-
-        template <typename ...Yn>
         explicit constexpr basic_tuple(Yn&& ...yn)
-            : Base(static_cast<Yn&&>(yn)...)
+            : Base(detail::ebo_init{}, static_cast<Yn&&>(yn)...)
         { }
     };
     //! @endcond
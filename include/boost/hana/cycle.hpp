@@ -20,7 +20,6 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
-#include <boost/hana/detail/array.hpp>
 #include <boost/hana/empty.hpp>
 #include <boost/hana/length.hpp>
 
@@ -87,39 +86,23 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
-    namespace detail {
-        template <std::size_t N, std::size_t Len>
-        struct cycle_indices {
-            static constexpr auto compute_value() {
-                detail::array<std::size_t, N * Len> indices{};
-                // Avoid (incorrect) Clang warning about remainder by zero
-                // in the loop below.
-                std::size_t len = Len;
-                for (std::size_t i = 0; i < N * Len; ++i)
-                    indices[i] = i % len;
-                return indices;
-            }
-
-            static constexpr auto value = compute_value();
-        };
-    }
-
     template <typename S>
     struct cycle_impl<S, when<Sequence<S>::value>> {
-        template <typename Indices, typename Xs, std::size_t ...i>
+        // The i-th element of the result is the (i % len)-th element of `xs`,
+        // so the result is created at once, without computing any index array
+        // nor creating any intermediate sequence.
+        template <std::size_t len, typename Xs, std::size_t ...i>
         static constexpr auto cycle_helper(Xs&& xs, std::index_sequence<i...>) {
-            constexpr auto indices = Indices::value;
-            (void)indices; // workaround GCC warning when sizeof...(i) == 0
-            return hana::make<S>(hana::at_c<indices[i]>(xs)...);
+            (void)xs; // workaround GCC warning when sizeof...(i) == 0
+            return hana::make<S>(hana::at_c<i % len>(xs)...);
         }
 
         template <typename Xs, typename N>
         static constexpr auto apply(Xs&& xs, N const&) {
             constexpr std::size_t n = N::value;
             constexpr std::size_t len = decltype(hana::length(xs))::value;
-            using Indices = detail::cycle_indices<n, len>;
-            return cycle_helper<Indices>(static_cast<Xs&&>(xs),
-                                         std::make_index_sequence<n * len>{});
+            return cycle_helper<len>(static_cast<Xs&&>(xs),
+                                     std::make_index_sequence<n * len>{});
         }
     };
 BOOST_HANA_NAMESPACE_END
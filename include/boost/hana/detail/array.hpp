@@ -100,6 +100,31 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         return M < N || detail::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
     }
 
+    //! @ingroup group-details
+    //! Returns the `k`-th permutation of `0, 1, ..., N - 1` in lexicographical
+    //! order, i.e. `array<std::size_t, N>{}.iota(0).permutations()[k]`.
+    //!
+    //! The permutation is decoded from the representation of `k` in the
+    //! factorial number system, which takes `O(N^2)` steps instead of
+    //! computing all the `N!` permutations.
+    template <std::size_t N>
+    constexpr array<std::size_t, N> nth_permutation(std::size_t k) {
+        array<std::size_t, N> result{};
+        bool used[N > 0 ? N : 1] = {};
+        std::size_t radix = detail::factorial(N);
+        for (std::size_t i = 0; i != N; ++i) {
+            radix /= N - i;
+            std::size_t digit = k / radix;
+            k %= radix;
+            std::size_t j = 0;
+            while (used[j] || digit-- != 0)
+                ++j;
+            used[j] = true;
+            result[i] = j;
+        }
+        return result;
+    }
+
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_ARRAY_HPP
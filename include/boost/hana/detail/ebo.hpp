@@ -30,7 +30,10 @@ namespace _hana {
     // Also, the constructors are open-ended and they do not check for the
     // validity of their arguments, again to reduce compile-time costs.
     // Users of `ebo` should make sure that they only try to construct an
-    // `ebo` from a compatible value.
+    // `ebo` from a compatible value. The constructor from a value takes an
+    // `ebo_init` tag first, so it never competes with the implicit copy
+    // and move constructors of `ebo`. Those are trivial when the ones of
+    // `V` are, and deleted when the ones of `V` are.
     //
     // EBOs can be indexed using an arbitrary type. The recommended usage is
     // to define an integrap constant wrapper for the specific container using
@@ -47,6 +50,8 @@ namespace _hana {
     // ambiguous base class conversion, since both tuple and pair inherit
     // from `ebo`s with the same keys.
     //////////////////////////////////////////////////////////////////////////
+    struct ebo_init { };
+
     template <typename K, typename V, bool =
         BOOST_HANA_TT_IS_EMPTY(V) && !BOOST_HANA_TT_IS_FINAL(V)
     >
@@ -58,7 +63,7 @@ namespace _hana {
         constexpr ebo() { }
 
         template <typename T>
-        explicit constexpr ebo(T&& t)
+        constexpr ebo(ebo_init, T&& t)
             : V(static_cast<T&&>(t))
         { }
     };
@@ -69,7 +74,7 @@ namespace _hana {
         constexpr ebo() : data_() { }
 
         template <typename T>
-        explicit constexpr ebo(T&& t)
+        constexpr ebo(ebo_init, T&& t)
             : data_(static_cast<T&&>(t))
         { }
 
@@ -109,6 +114,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     namespace detail {
         using ::_hana::ebo;
         using ::_hana::ebo_get;
+        using ::_hana::ebo_init;
     }
 BOOST_HANA_NAMESPACE_END
 
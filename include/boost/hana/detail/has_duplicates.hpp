@@ -12,10 +12,9 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/fast_and.hpp>
-#include <boost/hana/equal.hpp>
+#include <boost/hana/detail/key_equal.hpp>
 
 #include <cstddef>
-#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail {
@@ -23,7 +22,7 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     constexpr std::size_t pack_count() {
         std::size_t c = 0;
         std::size_t expand[] = {0, // avoid empty array
-            (decltype(hana::equal(std::declval<T>(), std::declval<U>()))::value
+            (detail::key_equal<T, U>::value
                 ? ++c
                 : c)...
         };
@@ -39,7 +38,9 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //! as _types_, but rather whether they are unique when compared as
     //! `hana::equal(std::declval<T>(), std::declval<U>())`. This assumes
     //! the comparison to return an `IntegralConstant` that can be explicitly
-    //! converted to `bool`.
+    //! converted to `bool`. The comparison is done with `detail::key_equal`,
+    //! which is cheaper for `hana::type`s, `integral_constant`s and
+    //! `hana::string`s.
     //!
     //! @note
     //! Since this utility is mostly used in assertions to check that there
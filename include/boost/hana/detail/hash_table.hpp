@@ -11,7 +11,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
-#include <boost/hana/equal.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/key_equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/find_if.hpp>
@@ -59,10 +60,9 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     template <template <std::size_t> class KeyAtIndex, typename Key>
     struct find_pred {
         template <typename Index>
-        auto operator()(Index const&) const -> decltype(
-            hana::equal(std::declval<KeyAtIndex<Index::value>>(),
-                        std::declval<Key>())
-        );
+        auto operator()(Index const&) const -> hana::bool_<
+            detail::key_equal<KeyAtIndex<Index::value>, Key>::value
+        >;
     };
 
     template <typename Indices, typename Key, template <std::size_t> class KeyAtIndex>
@@ -76,11 +76,8 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     // should make sure that we retain that speedup.
     template <std::size_t i, typename Key, template <std::size_t> class KeyAtIndex>
     struct find_index_impl<std::index_sequence<i>, Key, KeyAtIndex> {
-        using Equal = decltype(
-            hana::equal(std::declval<KeyAtIndex<i>>(),
-                        std::declval<Key>())
-        );
-        using type = typename std::conditional<Equal::value,
+        using type = typename std::conditional<
+            detail::key_equal<KeyAtIndex<i>, Key>::value,
             hana::optional<std::integral_constant<std::size_t, i>>,
             hana::optional<>
         >::type;
@@ -0,0 +1,99 @@
+/*!
+@file
+Defines `boost::hana::detail::iterable_cursor`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_ITERABLE_CURSOR_HPP
+#define BOOST_HANA_DETAIL_ITERABLE_CURSOR_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    struct iterable_cursor_tag { };
+
+    //! @ingroup group-details
+    //! Iterable referring to the elements of another Iterable, starting at
+    //! a compile-time offset.
+    //!
+    //! Generic algorithms on Iterables advance through their input with
+    //! `drop_front`. Most Iterables implement `drop_front` by creating a
+    //! new Iterable containing copies of the remaining elements, so
+    //! iterating over `n` elements that way performs O(n^2) copies and
+    //! template instantiations. Instead, these algorithms can iterate over
+    //! an `iterable_cursor`, for which `drop_front` only creates a cursor
+    //! with a larger offset. The original Iterable is only used through
+    //! `at` and in unevaluated calls to `drop_front` and `is_empty`.
+    //!
+    //! A cursor holds a pointer to the original Iterable, so it must not
+    //! outlive it.
+    template <typename Xs, std::size_t Offset>
+    struct iterable_cursor {
+        Xs* xs;
+
+        static constexpr std::size_t offset = Offset;
+        using hana_tag = iterable_cursor_tag;
+    };
+
+    template <typename Xs>
+    constexpr iterable_cursor<Xs, 0> make_iterable_cursor(Xs& xs)
+    { return {&xs}; }
+
+    template <typename Xs, std::size_t Offset>
+    struct iterable_cursor_is_empty
+        : decltype(hana::is_empty(hana::drop_front(std::declval<Xs&>(),
+                                                   hana::size_c<Offset>)))
+    { };
+
+    template <typename Xs>
+    struct iterable_cursor_is_empty<Xs, 0>
+        : decltype(hana::is_empty(std::declval<Xs&>()))
+    { };
+} BOOST_HANA_NAMESPACE_END
+
+BOOST_HANA_NAMESPACE_BEGIN
+    template <>
+    struct at_impl<detail::iterable_cursor_tag> {
+        template <typename Xs, std::size_t Offset, typename N>
+        static constexpr decltype(auto)
+        apply(detail::iterable_cursor<Xs, Offset> const& cursor, N const&) {
+            constexpr std::size_t n = N::value;
+            return hana::at_c<Offset + n>(*cursor.xs);
+        }
+    };
+
+    template <>
+    struct drop_front_impl<detail::iterable_cursor_tag> {
+        template <typename Xs, std::size_t Offset, typename N>
+        static constexpr auto
+        apply(detail::iterable_cursor<Xs, Offset> const& cursor, N const&) {
+            constexpr std::size_t n = N::value;
+            return detail::iterable_cursor<Xs, Offset + n>{cursor.xs};
+        }
+    };
+
+    template <>
+    struct is_empty_impl<detail::iterable_cursor_tag> {
+        template <typename Xs, std::size_t Offset>
+        static constexpr auto apply(detail::iterable_cursor<Xs, Offset> const&) {
+            return hana::bool_c<
+                detail::iterable_cursor_is_empty<Xs, Offset>::value
+            >;
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_ITERABLE_CURSOR_HPP
@@ -0,0 +1,78 @@
+/*!
+@file
+Defines `boost::hana::detail::key_equal`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_KEY_EQUAL_HPP
+#define BOOST_HANA_DETAIL_KEY_EQUAL_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    template <typename T, typename U>
+    std::is_same<T, U> equal_types(basic_type<T> const&, basic_type<U> const&);
+
+    template <typename K1, typename K2, typename = void>
+    struct key_equal_impl {
+        static constexpr bool value =
+            decltype(hana::equal(std::declval<K1>(), std::declval<K2>()))::value;
+    };
+
+    template <typename K1, typename K2>
+    struct key_equal_impl<K1, K2, decltype((void)detail::equal_types(
+        std::declval<K1>(), std::declval<K2>()
+    ))> {
+        static constexpr bool value = decltype(detail::equal_types(
+            std::declval<K1>(), std::declval<K2>()
+        ))::value;
+    };
+
+    template <typename T, T v, T w>
+    struct key_equal_impl<hana::integral_constant<T, v>, hana::integral_constant<T, w>> {
+        static constexpr bool value = v == w;
+    };
+
+    template <typename T, T v, T w>
+    struct key_equal_impl<std::integral_constant<T, v>, std::integral_constant<T, w>> {
+        static constexpr bool value = v == w;
+    };
+
+    template <char ...s, char ...t>
+    struct key_equal_impl<hana::string<s...>, hana::string<t...>> {
+        static constexpr bool value = std::is_same<
+            hana::string<s...>, hana::string<t...>
+        >::value;
+    };
+
+    //! @ingroup group-details
+    //! Returns whether two keys of an associative structure are equal,
+    //! which is `hana::equal(std::declval<K1>(), std::declval<K2>())`.
+    //!
+    //! Associative structures compare their keys a lot, and going through
+    //! `hana::equal` requires looking up an implementation of `equal` and
+    //! checking a few concepts for each pair of key types. For the keys that
+    //! are by far the most common, i.e. `hana::type`s, `integral_constant`s
+    //! of the same type and `hana::string`s, this is a peephole optimization
+    //! which compares the keys directly instead. Other keys are compared with
+    //! `hana::equal`, which must return an `IntegralConstant`.
+    template <typename K1, typename K2>
+    struct key_equal
+        : key_equal_impl<typename detail::decay<K1>::type,
+                         typename detail::decay<K2>::type>
+    { };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_KEY_EQUAL_HPP
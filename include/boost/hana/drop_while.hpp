@@ -17,6 +17,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/detail/first_unsatisfied_index.hpp>
+#include <boost/hana/detail/iterable_cursor.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/eval_if.hpp>
 #include <boost/hana/front.hpp>
@@ -66,13 +67,19 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename It, bool condition>
     struct drop_while_impl<It, when<condition>> : default_ {
+        // We find the first unsatisfied element by iterating over a cursor,
+        // and then drop all the preceding elements at once. This avoids
+        // creating a new Iterable each time we drop an element.
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&& pred) {
-            return hana::eval_if(hana::is_empty(xs),
-                hana::make_lazy(xs),
+            auto cursor = detail::make_iterable_cursor(xs);
+            using Rest = decltype(hana::eval_if(hana::is_empty(cursor),
+                hana::make_lazy(cursor),
                 hana::make_lazy(iterable_detail::drop_while_helper{})(
-                                            xs, static_cast<Pred&&>(pred))
-            );
+                                            cursor, static_cast<Pred&&>(pred))
+            ));
+            return hana::drop_front(static_cast<Xs&&>(xs),
+                                    hana::size_c<Rest::offset>);
         }
     };
 
@@ -0,0 +1,645 @@
+/*
+@file
+Defines `boost::hana::experimental::read_csv` and
+`boost::hana::experimental::read_csv_columns`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_CSV_HPP
+#define BOOST_HANA_EXPERIMENTAL_CSV_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Exception thrown by `experimental::read_csv` and
+    //! `experimental::read_csv_columns` when the input is not valid.
+    //!
+    //! `line()` is the line of the input, starting at 1, on which the
+    //! invalid record starts.
+    class csv_error : public std::runtime_error {
+        std::size_t line_;
+
+    public:
+        csv_error(std::string const& what, std::size_t line)
+            : std::runtime_error{"line " + std::to_string(line) + ": " + what}
+            , line_{line}
+        { }
+
+        std::size_t line() const noexcept
+        { return line_; }
+    };
+
+    //! @cond
+    template <typename T, typename = void>
+    struct csv_field_impl : csv_field_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct csv_field_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static bool apply(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    // model for integers
+    template <typename T>
+    struct csv_field_impl<T, hana::when<
+        std::is_integral<T>::value &&
+        !std::is_same<T, bool>::value &&
+        !std::is_same<T, char>::value
+    >> {
+        static bool apply(char const* first, char const* last, T& out) {
+            auto result = detail::string_to_integral<T>(
+                first, static_cast<std::size_t>(last - first));
+            out = result.value;
+            return result.valid;
+        }
+    };
+
+    namespace csv_detail {
+        inline float strto(char const* s, char** end, float*) { return std::strtof(s, end); }
+        inline double strto(char const* s, char** end, double*) { return std::strtod(s, end); }
+        inline long double strto(char const* s, char** end, long double*) { return std::strtold(s, end); }
+
+        // The largest power of ten and the largest integer which are exactly
+        // representable, when the fast path below can be used.
+        template <typename T>
+        struct exact_decimal {
+            static constexpr bool enabled = false;
+            static constexpr int max_power = 0;
+            static constexpr std::uint64_t max_digits = 0;
+        };
+
+    #if FLT_EVAL_METHOD == 0
+        template <>
+        struct exact_decimal<float> {
+            static constexpr bool enabled = true;
+            static constexpr int max_power = 10;
+            static constexpr std::uint64_t max_digits = std::uint64_t{1} << 24;
+        };
+
+        template <>
+        struct exact_decimal<double> {
+            static constexpr bool enabled = true;
+            static constexpr int max_power = 22;
+            static constexpr std::uint64_t max_digits = std::uint64_t{1} << 53;
+        };
+    #endif
+
+        // Parses fields of the form `[+-]digits[.digits]`. When the digits
+        // and the power of ten are both exactly representable, a single
+        // division is correctly rounded, so the result is the same as with
+        // `std::strtod`, which is much slower. Returns false for other
+        // fields, which are left to `std::strtod`.
+        template <typename T>
+        bool parse_decimal(char const* first, char const* last, T& out) {
+            using Exact = exact_decimal<T>;
+            if (!Exact::enabled)
+                return false;
+            bool negative = false;
+            if (first != last && (*first == '-' || *first == '+')) {
+                negative = *first == '-';
+                ++first;
+            }
+            std::uint64_t digits = 0;
+            int count = 0, power = 0;
+            for (; first != last && static_cast<unsigned>(*first - '0') < 10; ++first, ++count)
+                digits = digits * 10 + static_cast<unsigned>(*first - '0');
+            if (first != last && *first == '.') {
+                for (++first; first != last && static_cast<unsigned>(*first - '0') < 10; ++first, ++count, ++power)
+                    digits = digits * 10 + static_cast<unsigned>(*first - '0');
+            }
+            if (first != last || count == 0 || count > 19 ||
+                power > Exact::max_power || digits > Exact::max_digits)
+                return false;
+
+            static constexpr T powers[] = {
+                T(1e0), T(1e1), T(1e2), T(1e3), T(1e4), T(1e5), T(1e6), T(1e7),
+                T(1e8), T(1e9), T(1e10), T(1e11), T(1e12), T(1e13), T(1e14),
+                T(1e15), T(1e16), T(1e17), T(1e18), T(1e19), T(1e20), T(1e21),
+                T(1e22)
+            };
+            T value = static_cast<T>(digits) / powers[power];
+            out = negative ? -value : value;
+            return true;
+        }
+    }
+
+    // model for floating points
+    template <typename T>
+    struct csv_field_impl<T, hana::when<std::is_floating_point<T>::value>> {
+        static bool apply(char const* first, char const* last, T& out) {
+            if (csv_detail::parse_decimal(first, last, out))
+                return true;
+
+            // The conversion functions of the C library require a
+            // null-terminated string, but fields are not null-terminated.
+            char buffer[64];
+            std::string large;
+            std::size_t const n = static_cast<std::size_t>(last - first);
+            char const* s = buffer;
+            if (n < sizeof(buffer)) {
+                std::memcpy(buffer, first, n);
+                buffer[n] = '\0';
+            }
+            else {
+                large.assign(first, last);
+                s = large.c_str();
+            }
+            char* end;
+            out = csv_detail::strto(s, &end, static_cast<T*>(nullptr));
+            return n != 0 && end == s + n;
+        }
+    };
+
+    // model for bool
+    template <>
+    struct csv_field_impl<bool> {
+        static bool apply(char const* first, char const* last, bool& out) {
+            std::size_t const n = static_cast<std::size_t>(last - first);
+            if ((n == 1 && *first == '1') || (n == 4 && std::memcmp(first, "true", 4) == 0))
+                return out = true, true;
+            if ((n == 1 && *first == '0') || (n == 5 && std::memcmp(first, "false", 5) == 0))
+                return out = false, true;
+            return false;
+        }
+    };
+
+    // model for char
+    template <>
+    struct csv_field_impl<char> {
+        static bool apply(char const* first, char const* last, char& out) {
+            if (last - first != 1)
+                return false;
+            out = *first;
+            return true;
+        }
+    };
+
+    // model for std::string
+    template <>
+    struct csv_field_impl<std::string> {
+        static bool apply(char const* first, char const* last, std::string& out) {
+            out.assign(first, last);
+            return true;
+        }
+    };
+
+    namespace csv_detail {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        struct field {
+            char const* first;
+            char const* last;
+        };
+
+        inline char const* find(char const* first, char const* last, char c) {
+            return static_cast<char const*>(
+                std::memchr(first, c, static_cast<std::size_t>(last - first)));
+        }
+
+        // Splits a buffer into records, and records into fields.
+        //
+        // Most records do not contain any quote. For those, the end of the
+        // record and the delimiters are found with `std::memchr`, which is
+        // vectorized by the C library. Other records are read one character
+        // at a time. Fields are not copied, except for quoted fields with
+        // escaped quotes, which are unescaped into storage owned by the
+        // scanner and valid until the next record is read.
+        class scanner {
+            char const* p_;
+            char const* last_;
+            char delimiter_;
+            std::size_t line_;
+            std::size_t record_line_;
+            std::deque<std::string> unescaped_;
+
+            std::string& unescaped(std::size_t k) {
+                if (unescaped_.size() <= k)
+                    unescaped_.resize(k + 1);
+                return unescaped_[k];
+            }
+
+            bool at_line_end(char const* p) const {
+                return p == last_ || *p == '\n' ||
+                       (*p == '\r' && (p + 1 == last_ || p[1] == '\n'));
+            }
+
+            void read_quoted(std::vector<field>& fields) {
+                char const* p = p_;
+                for (std::size_t k = 0; ; ++k) {
+                    field f{p, p};
+                    if (p != last_ && *p == '"') {
+                        char const* const start = ++p;
+                        std::string* buffer = nullptr;
+                        while (true) {
+                            char const* q = csv_detail::find(p, last_, '"');
+                            if (q == nullptr)
+                                throw csv_error{"unterminated quoted field", record_line_};
+                            line_ += static_cast<std::size_t>(std::count(p, q, '\n'));
+                            if (q + 1 != last_ && q[1] == '"') {
+                                if (buffer == nullptr) {
+                                    buffer = &this->unescaped(k);
+                                    buffer->assign(start, q + 1);
+                                }
+                                else
+                                    buffer->append(p, q + 1);
+                                p = q + 2;
+                                continue;
+                            }
+                            if (buffer == nullptr)
+                                f = field{start, q};
+                            else {
+                                buffer->append(p, q);
+                                f = field{buffer->data(), buffer->data() + buffer->size()};
+                            }
+                            p = q + 1;
+                            break;
+                        }
+                        if (p != last_ && *p != delimiter_ && !this->at_line_end(p))
+                            throw csv_error{"unexpected character after a quoted field", line_};
+                    }
+                    else {
+                        char const* const start = p;
+                        while (p != last_ && *p != delimiter_ && *p != '\n')
+                            ++p;
+                        char const* end = p;
+                        if (end != start && end[-1] == '\r' && this->at_line_end(p))
+                            --end;
+                        f = field{start, end};
+                    }
+                    fields.push_back(f);
+
+                    if (p != last_ && *p == '\r')
+                        ++p;
+                    if (p == last_)
+                        break;
+                    if (*p++ == '\n')
+                        break;
+                }
+                ++line_;
+                p_ = p;
+            }
+
+        public:
+            scanner(char const* first, char const* last, char delimiter)
+                : p_{first}, last_{last}, delimiter_{delimiter}
+                , line_{1}, record_line_{1}
+            { }
+
+            // The line on which the last record read starts.
+            std::size_t line() const
+            { return record_line_; }
+
+            char const* position() const
+            { return p_; }
+
+            // Reads the next record into `fields`, and returns whether there
+            // was one. Blank lines are skipped.
+            bool next(std::vector<field>& fields) {
+                fields.clear();
+                while (p_ != last_ && (*p_ == '\n' || (*p_ == '\r' && this->at_line_end(p_)))) {
+                    if (*p_ == '\n')
+                        ++line_;
+                    ++p_;
+                }
+                if (p_ == last_)
+                    return false;
+
+                record_line_ = line_;
+                char const* eol = csv_detail::find(p_, last_, '\n');
+                if (eol == nullptr)
+                    eol = last_;
+                if (csv_detail::find(p_, eol, '"') != nullptr) {
+                    this->read_quoted(fields);
+                    return true;
+                }
+
+                char const* end = eol;
+                if (end[-1] == '\r')
+                    --end;
+                for (char const* f = p_; ; ) {
+                    char const* d = csv_detail::find(f, end, delimiter_);
+                    if (d == nullptr) {
+                        fields.push_back(field{f, end});
+                        break;
+                    }
+                    fields.push_back(field{f, d});
+                    f = d + 1;
+                }
+                ++line_;
+                p_ = eol == last_ ? last_ : eol + 1;
+                return true;
+            }
+        };
+
+        template <typename S>
+        using accessors_t = decltype(hana::accessors<S>());
+
+        template <typename S, std::size_t n>
+        using key_t = typename detail::decay<decltype(
+            hana::first(hana::at_c<n>(std::declval<accessors_t<S>>()))
+        )>::type;
+
+        template <typename S, std::size_t n>
+        using member_t = typename detail::decay<decltype(
+            hana::second(hana::at_c<n>(std::declval<accessors_t<S>>()))(std::declval<S&>())
+        )>::type;
+
+        template <typename Record>
+        using setter = bool (*)(Record&, field);
+
+        template <typename S, typename Indices = std::make_index_sequence<
+            decltype(hana::length(std::declval<accessors_t<S>>()))::value
+        >>
+        struct members;
+
+        template <typename S, std::size_t ...n>
+        struct members<S, std::index_sequence<n...>> {
+            static constexpr std::size_t size = sizeof...(n);
+
+            static constexpr bool has_string_keys = detail::fast_and<
+                detail::is_compile_time_string<key_t<S, n>>::value...
+            >::value;
+
+            static constexpr bool has_readable_members = detail::fast_and<
+                !hana::is_default<csv_field_impl<member_t<S, n>>>::value...
+            >::value;
+
+            using columns = decltype(hana::make_map(
+                hana::make_pair(key_t<S, n>{}, std::vector<member_t<S, n>>{})...
+            ));
+
+            template <std::size_t k>
+            static bool set_member(S& s, field f) {
+                return csv_field_impl<member_t<S, k>>::apply(
+                    f.first, f.last, hana::second(hana::at_c<k>(hana::accessors<S>()))(s));
+            }
+
+            template <std::size_t k>
+            static bool push_column(columns& c, field f) {
+                auto& column = hana::at_key(c, key_t<S, k>{});
+                column.emplace_back();
+                return csv_field_impl<member_t<S, k>>::apply(f.first, f.last, column.back());
+            }
+
+            static setter<S> row_setter(std::size_t k) {
+                static constexpr setter<S> setters[] = {&set_member<n>...};
+                return setters[k];
+            }
+
+            static setter<columns> column_setter(std::size_t k) {
+                static constexpr setter<columns> setters[] = {&push_column<n>...};
+                return setters[k];
+            }
+
+            static field name(std::size_t k) {
+                static constexpr field names[] = {{
+                    detail::string_array<key_t<S, n>>::type::get(),
+                    detail::string_array<key_t<S, n>>::type::get() +
+                        detail::string_ref_length<typename detail::string_array<key_t<S, n>>::type>
+                }...};
+                return names[k];
+            }
+
+            // Returns the index of the member named by a header field, or
+            // `npos` if there is no such member.
+            static std::size_t find(field f) {
+                std::size_t const length = static_cast<std::size_t>(f.last - f.first);
+                for (std::size_t k = 0; k != size; ++k) {
+                    field name = members::name(k);
+                    if (static_cast<std::size_t>(name.last - name.first) == length &&
+                        std::memcmp(name.first, f.first, length) == 0)
+                        return k;
+                }
+                return npos;
+            }
+        };
+
+        // Reads the header, then calls `begin()` for each record to get the
+        // object in which its fields are stored. `reserve(n)` is called once
+        // with an estimate of the number of records, computed from the size
+        // of the first one.
+        template <typename S, typename Record, typename Setter, typename Begin, typename Reserve>
+        void read(char const* first, char const* last, char delimiter,
+                  Setter setter_of, Begin begin, Reserve reserve)
+        {
+            using Members = members<S>;
+            scanner records{first, last, delimiter};
+            std::vector<field> fields;
+            if (!records.next(fields))
+                throw csv_error{"missing header", 1};
+
+            // Map each column to the member it is read into once, so that
+            // reading a field is only an indirect call.
+            std::vector<std::size_t> column_member(fields.size(), npos);
+            std::vector<setter<Record>> setters(fields.size(), nullptr);
+            bool found[Members::size] = {};
+            for (std::size_t c = 0; c != fields.size(); ++c) {
+                std::size_t k = Members::find(fields[c]);
+                if (k == npos)
+                    continue;
+                if (found[k])
+                    throw csv_error{"duplicate column '" +
+                        std::string(fields[c].first, fields[c].last) + "'", 1};
+                found[k] = true;
+                column_member[c] = k;
+                setters[c] = setter_of(k);
+            }
+            for (std::size_t k = 0; k != Members::size; ++k) {
+                if (!found[k]) {
+                    field name = Members::name(k);
+                    throw csv_error{"missing column '" +
+                        std::string(name.first, name.last) + "'", records.line()};
+                }
+            }
+
+            std::size_t const columns = column_member.size();
+            char const* const body = records.position();
+            bool first_record = true;
+            while (records.next(fields)) {
+                if (fields.size() != columns)
+                    throw csv_error{"expected " + std::to_string(columns) +
+                        " fields, found " + std::to_string(fields.size()), records.line()};
+                if (first_record) {
+                    first_record = false;
+                    std::size_t const size = static_cast<std::size_t>(records.position() - body);
+                    reserve(static_cast<std::size_t>(last - body) / size + 1);
+                }
+                Record& record = begin();
+                for (std::size_t c = 0; c != columns; ++c) {
+                    if (setters[c] != nullptr && !setters[c](record, fields[c])) {
+                        field name = Members::name(column_member[c]);
+                        throw csv_error{"invalid value '" +
+                            std::string(fields[c].first, fields[c].last) + "' for column '" +
+                            std::string(name.first, name.last) + "'", records.line()};
+                    }
+                }
+            }
+        }
+
+        template <typename S>
+        struct checks {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Struct<S>::value,
+            "hana::experimental::read_csv<T> requires 'T' to be a Struct");
+
+            static_assert(members<S>::size != 0,
+            "hana::experimental::read_csv<T> requires 'T' to have at least one member");
+
+            static_assert(members<S>::has_string_keys,
+            "hana::experimental::read_csv<T> requires the keys of 'T' to be compile-time strings");
+
+            static_assert(members<S>::has_readable_members,
+            "hana::experimental::read_csv<T> requires each member of 'T' to be readable "
+            "from a field; specialize hana::experimental::csv_field_impl for its type");
+        #endif
+            using type = S;
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! The per-column representation of records of type `T` returned by
+    //! `experimental::read_csv_columns<T>`.
+    //!
+    //! This is a `hana::map` from the name of each member of `T` to a
+    //! `std::vector` of values of the type of that member.
+    template <typename T>
+    using csv_columns = typename csv_detail::members<
+        typename csv_detail::checks<T>::type
+    >::columns;
+
+    //! @ingroup group-experimental
+    //! Reads CSV records into `Struct`s of type `T`.
+    //!
+    //! `read_csv<T>(first, last)` reads the CSV data in `[first, last)`, and
+    //! returns a `std::vector<T>` holding one object per record. The first
+    //! record is a header, and each member of `T` is read from the column
+    //! with the same name; other columns are ignored. The input may also be
+    //! a null-terminated string or any object with `data()` and `size()`,
+    //! like a `std::string` or a memory-mapped file. An optional last
+    //! argument specifies the delimiter, which is `','` by default.
+    //!
+    //! Fields may be quoted with `"`, in which case they can contain the
+    //! delimiter, newlines and quotes escaped as `""`. Both `\n` and `\r\n`
+    //! end a record, and blank lines are skipped. If the input is not valid,
+    //! `experimental::csv_error` is thrown.
+    //!
+    //! The header is matched with the names of the members of `T` once.
+    //! After that, the end of each record and the delimiters are found with
+    //! `std::memchr`, which the C library vectorizes, and each field is
+    //! converted by a function selected at compile-time from the type of
+    //! its member. Integers, floating points, `bool`, `char` and `std::string`
+    //! are supported out of the box, and other types can be supported by
+    //! specializing `experimental::csv_field_impl`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T>
+    auto read_csv = [](auto first, auto last, char delimiter = ',') {
+        return std::vector<T>{...};
+    };
+#else
+    template <typename T>
+    struct read_csv_t {
+        std::vector<T> operator()(char const* first, char const* last, char delimiter = ',') const {
+            using Members = csv_detail::members<typename csv_detail::checks<T>::type>;
+            std::vector<T> rows;
+            csv_detail::read<T, T>(first, last, delimiter,
+                &Members::row_setter,
+                [&]() -> T& { rows.emplace_back(); return rows.back(); },
+                [&](std::size_t n) { rows.reserve(n); }
+            );
+            return rows;
+        }
+
+        std::vector<T> operator()(char const* s, char delimiter = ',') const
+        { return (*this)(s, s + std::strlen(s), delimiter); }
+
+        template <typename String>
+        auto operator()(String const& s, char delimiter = ',') const
+            -> decltype((void)s.data(), (void)s.size(), std::vector<T>{})
+        { return (*this)(s.data(), s.data() + s.size(), delimiter); }
+    };
+
+    template <typename T>
+    constexpr read_csv_t<T> read_csv{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Reads CSV records into one array per member of a `Struct` `T`.
+    //!
+    //! This is like `experimental::read_csv<T>`, but it returns an
+    //! `experimental::csv_columns<T>`, i.e. a `hana::map` from the name of
+    //! each member of `T` to a `std::vector` holding the value of that member
+    //! for each record. This is useful when the records are processed one
+    //! column at a time.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T>
+    auto read_csv_columns = [](auto first, auto last, char delimiter = ',') {
+        return csv_columns<T>{...};
+    };
+#else
+    template <typename T>
+    struct read_csv_columns_t {
+        csv_columns<T> operator()(char const* first, char const* last, char delimiter = ',') const {
+            using Members = csv_detail::members<T>;
+            csv_columns<T> columns;
+            csv_detail::read<T, csv_columns<T>>(first, last, delimiter,
+                &Members::column_setter,
+                [&]() -> csv_columns<T>& { return columns; },
+                [&](std::size_t n) {
+                    hana::for_each(columns, [&](auto& column) {
+                        hana::second(column).reserve(n);
+                    });
+                }
+            );
+            return columns;
+        }
+
+        csv_columns<T> operator()(char const* s, char delimiter = ',') const
+        { return (*this)(s, s + std::strlen(s), delimiter); }
+
+        template <typename String>
+        auto operator()(String const& s, char delimiter = ',') const
+            -> decltype((void)s.data(), (void)s.size(), csv_columns<T>{})
+        { return (*this)(s.data(), s.data() + s.size(), delimiter); }
+    };
+
+    template <typename T>
+    constexpr read_csv_columns_t<T> read_csv_columns{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_CSV_HPP
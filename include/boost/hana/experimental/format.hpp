@@ -0,0 +1,445 @@
+/*!
+@file
+Defines `boost::hana::experimental::format`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
+#define BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    template <typename T>
+    struct Formattable;
+
+    //! @cond
+    template <typename T, typename = void>
+    struct format_impl : format_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct format_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static void apply(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    namespace format_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Parsing of the format specification
+        //////////////////////////////////////////////////////////////////////
+        struct spec_info {
+            bool valid;
+            std::size_t placeholders;
+            std::size_t text_length;
+        };
+
+        // A format specification is literal text, in which `{}` denotes a
+        // placeholder and `{{` and `}}` denote literal braces.
+        constexpr spec_info analyze(char const* s, std::size_t n) {
+            spec_info info{true, 0, 0};
+            for (std::size_t i = 0; i != n; ++i) {
+                char next = i + 1 != n ? s[i + 1] : '\0';
+                if (s[i] == '{' && next == '}') {
+                    ++info.placeholders;
+                    ++i;
+                }
+                else if ((s[i] == '{' || s[i] == '}') && next != s[i]) {
+                    info.valid = false;
+                    return info;
+                }
+                else {
+                    ++info.text_length;
+                    if (s[i] == '{' || s[i] == '}')
+                        ++i;
+                }
+            }
+            return info;
+        }
+
+        // The unescaped literal text, and the offset in that text at which
+        // each argument must be written. `offsets[0]` is always 0, and
+        // `offsets[Placeholders + 1]` is always the length of the text.
+        template <std::size_t TextLength, std::size_t Placeholders>
+        struct spec_tables {
+            char text[TextLength + 1];
+            std::size_t offsets[Placeholders + 2];
+        };
+
+        template <std::size_t TextLength, std::size_t Placeholders>
+        constexpr spec_tables<TextLength, Placeholders>
+        make_tables(char const* s, std::size_t n) {
+            spec_tables<TextLength, Placeholders> tables{};
+            std::size_t out = 0, k = 0;
+            for (std::size_t i = 0; i != n; ++i) {
+                if (s[i] == '{' && s[i + 1] == '}') {
+                    tables.offsets[++k] = out;
+                    ++i;
+                }
+                else {
+                    tables.text[out++] = s[i];
+                    if (s[i] == '{' || s[i] == '}')
+                        ++i;
+                }
+            }
+            tables.offsets[Placeholders + 1] = out;
+            return tables;
+        }
+
+        template <typename P>
+        struct spec {
+            static constexpr spec_info info =
+                format_detail::analyze(P::get(), detail::string_ref_length<P>);
+
+            static_assert(info.valid,
+            "hana::experimental::format(fmt) requires 'fmt' to be a valid "
+            "format specification; braces must be escaped as '{{' and '}}'");
+
+            static constexpr spec_tables<info.text_length, info.placeholders>
+            tables = format_detail::make_tables<
+                info.text_length, info.placeholders
+            >(P::get(), detail::string_ref_length<P>);
+        };
+
+        template <typename P>
+        constexpr spec_info spec<P>::info;
+
+        template <typename P>
+        constexpr spec_tables<spec<P>::info.text_length, spec<P>::info.placeholders>
+        spec<P>::tables;
+
+        //////////////////////////////////////////////////////////////////////
+        // Output
+        //////////////////////////////////////////////////////////////////////
+        // Writes at most `capacity` characters to `buffer`, but keeps track
+        // of the number of characters that would have been written.
+        struct buffer_sink {
+            char* buffer;
+            std::size_t capacity;
+            std::size_t size;
+
+            void put(char c) {
+                if (size < capacity)
+                    buffer[size] = c;
+                ++size;
+            }
+
+            void write(char const* s, std::size_t n) {
+                if (size < capacity)
+                    std::memcpy(buffer + size, s,
+                                n < capacity - size ? n : capacity - size);
+                size += n;
+            }
+        };
+
+        template <typename Sink, typename X>
+        void format_one(Sink& sink, X const& x);
+
+        template <typename Sink, typename U>
+        void write_unsigned(Sink& sink, U value) {
+            char digits[3 * sizeof(U) + 1];
+            char* first = digits + sizeof(digits);
+            do {
+                *--first = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            sink.write(first, static_cast<std::size_t>(digits + sizeof(digits) - first));
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Creates a formatter from a compile-time format specification.
+    //!
+    //! Given a compile-time string `fmt` (a `hana::string` or a
+    //! `hana::string_ref`), `format(fmt)` returns a formatter. The format
+    //! specification is literal text in which each `{}` is a placeholder
+    //! for an argument, and `{{` and `}}` stand for literal braces. It is
+    //! parsed once at compile-time; the formatter only copies precomputed
+    //! pieces of text and converts each argument with a function chosen
+    //! statically from its type.
+    //!
+    //! The formatter is called as `formatter(buffer, size, args...)`. Like
+    //! `std::snprintf`, it writes at most `size - 1` characters followed by
+    //! a null terminator to `buffer`, and returns the number of characters
+    //! that would have been written if `size` had been large enough. It
+    //! never allocates.
+    //!
+    //! The following arguments are supported out of the box:
+    //! - `bool`, written as `true` or `false`
+    //! - `char`, written as a character
+    //! - other integral types, written in decimal
+    //! - floating point types, written like `%f` (6 decimals)
+    //! - null-terminated strings, `hana::string`s and `hana::string_ref`s,
+    //!   as well as contiguous ranges of characters like `std::string`
+    //! - `Struct`s, written as `{member: value, ...}`, recursively
+    //!
+    //! Other types can be supported by specializing
+    //! `experimental::format_impl` for their tag, with a static function
+    //! `apply(sink, x)` that writes `x` through `sink.put(char)` and
+    //! `sink.write(char const*, std::size_t)`.
+    template <typename P>
+    struct formatter {
+        using Spec = format_detail::spec<P>;
+
+        //! The number of arguments expected by the formatter.
+        static constexpr std::size_t arity = Spec::info.placeholders;
+
+        template <typename Sink, typename ...Args, std::size_t ...k>
+        static void write_impl(Sink& sink, std::index_sequence<k...>,
+                               Args const& ...args)
+        {
+            constexpr auto const& tables = Spec::tables;
+            int expand[] = {0, (
+                sink.write(tables.text + tables.offsets[k],
+                           tables.offsets[k + 1] - tables.offsets[k]),
+                format_detail::format_one(sink, args),
+            0)...};
+            (void)expand;
+            sink.write(tables.text + tables.offsets[arity],
+                       tables.offsets[arity + 1] - tables.offsets[arity]);
+        }
+
+        //! Writes the formatted arguments to any sink providing `put(char)`
+        //! and `write(char const*, std::size_t)`.
+        template <typename Sink, typename ...Args>
+        static void write(Sink& sink, Args const& ...args) {
+            static_assert(sizeof...(Args) == arity,
+            "hana::experimental::format(fmt)(buffer, size, args...) requires "
+            "the number of arguments to match the number of placeholders in "
+            "'fmt'");
+            write_impl(sink, std::make_index_sequence<arity>{}, args...);
+        }
+
+        template <typename ...Args>
+        std::size_t operator()(char* buffer, std::size_t size, Args const& ...args) const {
+            format_detail::buffer_sink sink{buffer, size == 0 ? 0 : size - 1, 0};
+            write(sink, args...);
+            if (size != 0)
+                buffer[sink.size < size ? sink.size : size - 1] = '\0';
+            return sink.size;
+        }
+    };
+
+    template <typename P>
+    constexpr std::size_t formatter<P>::arity;
+
+    struct format_t {
+        template <typename S>
+        constexpr auto operator()(S const&) const {
+            using Tag = typename hana::tag_of<S>::type;
+            static_assert(std::is_same<Tag, hana::string_tag>::value ||
+                          std::is_same<Tag, hana::string_ref_tag>::value,
+            "hana::experimental::format(fmt) requires 'fmt' to be a "
+            "compile-time string");
+            return formatter<typename hana::detail::string_array<S>::type>{};
+        }
+    };
+
+    constexpr format_t format{};
+
+    // Define the `Formattable` concept
+    template <typename T>
+    struct Formattable {
+        using Tag = typename hana::tag_of<T>::type;
+        static constexpr bool value = !hana::is_default<format_impl<Tag>>::value;
+    };
+
+    template <typename Sink, typename X>
+    void format_detail::format_one(Sink& sink, X const& x) {
+        using Tag = typename hana::tag_of<X>::type;
+        using Format = BOOST_HANA_DISPATCH_IF(format_impl<Tag>,
+            hana::experimental::Formattable<Tag>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::experimental::Formattable<Tag>::value,
+        "hana::experimental::format(fmt)(buffer, size, args...) requires "
+        "each argument to be Formattable");
+    #endif
+
+        Format::apply(sink, x);
+    }
+
+    namespace format_detail {
+        template <typename T, typename = void>
+        struct is_character_range : std::false_type { };
+
+        template <typename T>
+        struct is_character_range<T, decltype((void)(
+            static_cast<char const*>(std::declval<T const&>().data()) +
+            std::declval<T const&>().size()
+        ))> : std::integral_constant<bool, !std::is_convertible<T, char const*>::value> { };
+    }
+
+    // model for bool
+    template <>
+    struct format_impl<bool> {
+        template <typename Sink>
+        static void apply(Sink& sink, bool b) {
+            if (b) sink.write("true", 4);
+            else   sink.write("false", 5);
+        }
+    };
+
+    // model for char
+    template <>
+    struct format_impl<char> {
+        template <typename Sink>
+        static void apply(Sink& sink, char c)
+        { sink.put(c); }
+    };
+
+    // model for the other integral types
+    template <typename T>
+    struct format_impl<T, hana::when<
+        std::is_integral<T>::value &&
+        !std::is_same<T, bool>::value &&
+        !std::is_same<T, char>::value
+    >> {
+        using U = typename std::make_unsigned<T>::type;
+
+        template <typename Sink>
+        static void apply_impl(Sink& sink, T x, std::true_type) {
+            if (x < 0) {
+                sink.put('-');
+                format_detail::write_unsigned(sink, static_cast<U>(U(0) - static_cast<U>(x)));
+            }
+            else {
+                format_detail::write_unsigned(sink, static_cast<U>(x));
+            }
+        }
+
+        template <typename Sink>
+        static void apply_impl(Sink& sink, T x, std::false_type)
+        { format_detail::write_unsigned(sink, x); }
+
+        template <typename Sink>
+        static void apply(Sink& sink, T x)
+        { apply_impl(sink, x, std::is_signed<T>{}); }
+    };
+
+    // model for floating point types
+    template <typename T>
+    struct format_impl<T, hana::when<std::is_floating_point<T>::value>> {
+        template <typename Sink>
+        static void apply(Sink& sink, T x) {
+            if (std::isnan(x)) {
+                sink.write("nan", 3);
+                return;
+            }
+            if (std::signbit(x)) {
+                sink.put('-');
+                x = -x;
+            }
+            if (std::isinf(x)) {
+                sink.write("inf", 3);
+                return;
+            }
+
+            // Values which can't be split into a 64 bits integral part are
+            // rare enough that we defer to the C library for them.
+            if (!(x < static_cast<T>(1e18))) {
+                char digits[64];
+                int n = std::snprintf(digits, sizeof(digits), "%f", static_cast<double>(x));
+                sink.write(digits, static_cast<std::size_t>(n) < sizeof(digits)
+                                    ? static_cast<std::size_t>(n) : sizeof(digits) - 1);
+                return;
+            }
+
+            unsigned long long integral = static_cast<unsigned long long>(x);
+            unsigned long long decimals = static_cast<unsigned long long>(
+                (x - static_cast<T>(integral)) * static_cast<T>(1000000) + static_cast<T>(0.5)
+            );
+            if (decimals >= 1000000) {
+                ++integral;
+                decimals -= 1000000;
+            }
+            format_detail::write_unsigned(sink, integral);
+            char fraction[7] = {'.', '0', '0', '0', '0', '0', '0'};
+            for (int i = 6; i != 0; --i, decimals /= 10)
+                fraction[i] = static_cast<char>('0' + decimals % 10);
+            sink.write(fraction, 7);
+        }
+    };
+
+    // model for null-terminated strings
+    //! @cond
+    template <typename T>
+    struct format_impl<T, hana::when<
+        std::is_convertible<T, char const*>::value
+    >> {
+        template <typename Sink>
+        static void apply(Sink& sink, char const* s) {
+            if (s == nullptr) sink.write("(null)", 6);
+            else              sink.write(s, std::strlen(s));
+        }
+    };
+
+    // model for contiguous ranges of characters (e.g. `std::string`)
+    template <typename T>
+    struct format_impl<T, hana::when<
+        format_detail::is_character_range<T>::value
+    >> {
+        template <typename Sink, typename S>
+        static void apply(Sink& sink, S const& s)
+        { sink.write(s.data(), s.size()); }
+    };
+    //! @endcond
+
+    // model for compile-time strings
+    template <>
+    struct format_impl<hana::string_tag> {
+        template <typename Sink, typename S>
+        static void apply(Sink& sink, S const&) {
+            using P = typename hana::detail::string_array<S>::type;
+            sink.write(P::get(), hana::detail::string_ref_length<P>);
+        }
+    };
+
+    template <>
+    struct format_impl<hana::string_ref_tag>
+        : format_impl<hana::string_tag>
+    { };
+
+    // model for Structs
+    template <typename S>
+    struct format_impl<S, hana::when<hana::Struct<S>::value>> {
+        template <typename Sink, typename X>
+        static void apply(Sink& sink, X const& x) {
+            bool first = true;
+            sink.put('{');
+            hana::for_each(hana::accessors<S>(), [&](auto const& accessor) {
+                if (!first)
+                    sink.write(", ", 2);
+                first = false;
+                format_impl<hana::string_tag>::apply(sink, hana::first(accessor));
+                sink.write(": ", 2);
+                format_detail::format_one(sink, hana::second(accessor)(x));
+            });
+            sink.put('}');
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
@@ -0,0 +1,413 @@
+/*
+@file
+Defines `boost::hana::experimental::parallel_for_each` and
+`boost::hana::experimental::parallel_transform`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+#define BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#   define BOOST_HANA_EXPERIMENTAL_PARALLEL_EXCEPTIONS
+#endif
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Executor running each task immediately, on the calling thread.
+    //!
+    //! An executor is any object with a `execute(f)` member function
+    //! running the nullary function `f` at some point before the executor
+    //! is destroyed, possibly on another thread. `inline_executor` is the
+    //! simplest executor; it makes `parallel_for_each` and
+    //! `parallel_transform` behave exactly like their sequential
+    //! counterparts, which is useful for testing and debugging.
+    struct inline_executor {
+        template <typename F>
+        void execute(F&& f) const
+        { static_cast<F&&>(f)(); }
+    };
+
+    //! @ingroup group-experimental
+    //! Work-stealing pool of threads usable as an executor.
+    //!
+    //! Each worker thread owns a queue of tasks. Tasks are distributed
+    //! among the queues in a round-robin fashion, and a worker whose queue
+    //! is empty steals tasks from the other queues. The destructor runs all
+    //! the remaining tasks and joins the threads.
+    //!
+    //! A thread waiting for a group of tasks submitted to a `thread_pool`
+    //! with `parallel_for_each` or `parallel_transform` runs the pending
+    //! tasks of the pool while it waits, so these functions can be nested
+    //! without exhausting the pool.
+    class thread_pool {
+        struct queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<queue>> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<std::size_t> next_;
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::size_t queued_;
+        bool stop_;
+
+        bool pop(std::size_t first, std::function<void()>& task) {
+            // Tasks are taken from the back of the queue at `first` and
+            // stolen from the front of the other queues, so that the owner
+            // of a queue and the thieves rarely want the same task.
+            for (std::size_t i = 0; i != queues_.size(); ++i) {
+                queue& q = *queues_[(first + i) % queues_.size()];
+                std::lock_guard<std::mutex> lock{q.mutex};
+                if (q.tasks.empty())
+                    continue;
+                if (i == 0) {
+                    task = std::move(q.tasks.back());
+                    q.tasks.pop_back();
+                } else {
+                    task = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                }
+                std::lock_guard<std::mutex> count{mutex_};
+                --queued_;
+                return true;
+            }
+            return false;
+        }
+
+        void work(std::size_t index) {
+            std::function<void()> task;
+            while (true) {
+                if (pop(index, task)) {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock{mutex_};
+                ready_.wait(lock, [this] { return stop_ || queued_ != 0; });
+                if (stop_ && queued_ == 0)
+                    return;
+            }
+        }
+
+    public:
+        //! Creates a pool with the given number of threads, which defaults
+        //! to the number of hardware threads. A pool has at least one thread.
+        explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+            : next_{0}, queued_{0}, stop_{false}
+        {
+            if (threads == 0)
+                threads = 1;
+            for (std::size_t i = 0; i != threads; ++i)
+                queues_.push_back(std::make_unique<queue>());
+            for (std::size_t i = 0; i != threads; ++i)
+                threads_.emplace_back([this, i] { this->work(i); });
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                stop_ = true;
+            }
+            ready_.notify_all();
+            for (std::thread& thread : threads_)
+                thread.join();
+        }
+
+        //! Returns the number of threads in the pool.
+        std::size_t size() const
+        { return threads_.size(); }
+
+        //! Queues the nullary function `f` to be run by one of the threads.
+        template <typename F>
+        void execute(F&& f) {
+            std::size_t index = next_++ % queues_.size();
+            {
+                queue& q = *queues_[index];
+                std::lock_guard<std::mutex> lock{q.mutex};
+                q.tasks.emplace_back(static_cast<F&&>(f));
+            }
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                ++queued_;
+            }
+            ready_.notify_one();
+        }
+
+        //! Runs one of the queued tasks on the calling thread, if any.
+        //! Returns whether a task was run.
+        bool try_run_one() {
+            std::function<void()> task;
+            if (!pop(next_.load() % queues_.size(), task))
+                return false;
+            task();
+            return true;
+        }
+    };
+
+    //! @ingroup group-experimental
+    //! Returns a process-wide `thread_pool` with one thread per hardware
+    //! thread, created on first use.
+    inline thread_pool& default_thread_pool() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    namespace parallel_detail {
+        // Keeps track of the number of tasks of a call to `parallel_for_each`
+        // or `parallel_transform` that are not finished yet, and of the first
+        // exception thrown by one of them.
+        class task_group {
+            std::mutex mutex_;
+            std::condition_variable done_;
+            std::size_t pending_;
+        #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_EXCEPTIONS
+            std::exception_ptr error_;
+        #endif
+
+            void finish() {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (--pending_ == 0)
+                    done_.notify_all();
+            }
+
+        public:
+            explicit task_group(std::size_t tasks)
+                : pending_{tasks}
+            { }
+
+            template <typename F>
+            void run(F const& f) {
+            #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_EXCEPTIONS
+                try {
+                    f();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    if (!error_)
+                        error_ = std::current_exception();
+                }
+            #else
+                f();
+            #endif
+                finish();
+            }
+
+            bool finished() {
+                std::lock_guard<std::mutex> lock{mutex_};
+                return pending_ == 0;
+            }
+
+            void wait() {
+                std::unique_lock<std::mutex> lock{mutex_};
+                done_.wait(lock, [this] { return pending_ == 0; });
+            #ifdef BOOST_HANA_EXPERIMENTAL_PARALLEL_EXCEPTIONS
+                if (error_)
+                    std::rethrow_exception(error_);
+            #endif
+            }
+        };
+
+        template <typename Executor>
+        void wait(Executor&, task_group& group)
+        { group.wait(); }
+
+        inline void wait(thread_pool& pool, task_group& group) {
+            while (!group.finished() && pool.try_run_one())
+                ;
+            group.wait();
+        }
+
+        template <typename Executor, typename F>
+        void submit(Executor& executor, task_group& group, F f) {
+            executor.execute([&group, f] { group.run(f); });
+        }
+
+        template <typename F, typename Executor>
+        struct on_each_parallel {
+            F* f;
+            Executor* executor;
+
+            template <typename ...Xs>
+            void operator()(Xs&& ...xs) const {
+                task_group group{sizeof...(Xs)};
+                using Swallow = int[];
+                (void)Swallow{0, ((void)parallel_detail::submit(*executor, group,
+                    [this, &xs] { (*f)(static_cast<Xs&&>(xs)); }
+                ), 0)...};
+                parallel_detail::wait(*executor, group);
+            }
+        };
+
+        // Storage for the result of one of the tasks of `parallel_transform`,
+        // which is constructed by the task itself.
+        template <typename T>
+        class result_slot {
+            alignas(T) unsigned char storage_[sizeof(T)];
+            bool engaged_ = false;
+
+        public:
+            result_slot() = default;
+            result_slot(result_slot const&) = delete;
+            result_slot& operator=(result_slot const&) = delete;
+
+            template <typename F>
+            void emplace(F const& f) {
+                ::new (static_cast<void*>(storage_)) T(f());
+                engaged_ = true;
+            }
+
+            T&& get()
+            { return static_cast<T&&>(*reinterpret_cast<T*>(storage_)); }
+
+            ~result_slot() {
+                if (engaged_)
+                    reinterpret_cast<T*>(storage_)->~T();
+            }
+        };
+
+        template <typename S, typename Xs, typename F, typename Executor,
+                  std::size_t ...i>
+        auto parallel_transform(Xs&& xs, F const& f, Executor& executor,
+                                std::index_sequence<i...>)
+        {
+            hana::basic_tuple<result_slot<typename std::decay<decltype(
+                f(hana::at_c<i>(static_cast<Xs&&>(xs)))
+            )>::type>...> results;
+            task_group group{sizeof...(i)};
+            using Swallow = int[];
+            (void)Swallow{0, ((void)parallel_detail::submit(executor, group,
+                [&f, &xs, &results] {
+                    hana::at_c<i>(results).emplace([&f, &xs] {
+                        return f(hana::at_c<i>(static_cast<Xs&&>(xs)));
+                    });
+                }
+            ), 0)...};
+            parallel_detail::wait(executor, group);
+            return hana::make<S>(hana::at_c<i>(results).get()...);
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Calls a function on each element of a structure, concurrently.
+    //!
+    //! `parallel_for_each(xs, f, executor)` submits one task per element
+    //! `x` of the `Foldable` `xs` to the given executor, each of which
+    //! calls `f(x)`, and returns once all the tasks are finished. The
+    //! executor defaults to `default_thread_pool()`, and can be any object
+    //! with an `execute` member function (see `inline_executor`).
+    //!
+    //! Since different elements are processed on different threads, `f`
+    //! must be safe to call concurrently. This is meant for structures
+    //! whose elements represent independent and substantial work, like a
+    //! tuple of processing stages; for trivial work, the cost of
+    //! submitting the tasks dominates and `hana::for_each` is faster.
+    //!
+    //! If a call to `f` throws an exception, the other tasks still run to
+    //! completion and the first exception to be thrown is then rethrown by
+    //! `parallel_for_each`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto parallel_for_each = [](auto&& xs, auto&& f, auto&& executor = default_thread_pool()) {
+        return tag-dispatched;
+    };
+#else
+    struct parallel_for_each_t {
+        template <typename Xs, typename F, typename Executor>
+        void operator()(Xs&& xs, F const& f, Executor&& executor) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Foldable<typename hana::tag_of<Xs>::type>::value,
+            "hana::experimental::parallel_for_each(xs, f, executor) requires "
+            "'xs' to be Foldable");
+        #endif
+
+            using E = typename std::remove_reference<Executor>::type;
+            hana::unpack(static_cast<Xs&&>(xs),
+                         parallel_detail::on_each_parallel<F const, E>{&f, &executor});
+        }
+
+        template <typename Xs, typename F>
+        void operator()(Xs&& xs, F const& f) const
+        { (*this)(static_cast<Xs&&>(xs), f, experimental::default_thread_pool()); }
+    };
+
+    constexpr parallel_for_each_t parallel_for_each{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Applies a function to each element of a sequence, concurrently.
+    //!
+    //! `parallel_transform(xs, f, executor)` is equivalent to
+    //! `hana::transform(xs, f)`, except each `f(x)` is computed by a
+    //! different task submitted to the executor, like `parallel_for_each`
+    //! does. The results are stored in the same order as the elements of
+    //! `xs`, regardless of the order in which the tasks finish. `xs` must
+    //! be a `Sequence`, and `f` may not return `void`.
+    //!
+    //! If a call to `f` throws an exception, the other tasks still run to
+    //! completion, the results that were computed are destroyed and the
+    //! first exception to be thrown is then rethrown.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto parallel_transform = [](auto&& xs, auto&& f, auto&& executor = default_thread_pool()) {
+        return tag-dispatched;
+    };
+#else
+    struct parallel_transform_t {
+        template <typename Xs, typename F, typename Executor>
+        auto operator()(Xs&& xs, F const& f, Executor&& executor) const {
+            using S = typename hana::tag_of<Xs>::type;
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(hana::Sequence<S>::value,
+            "hana::experimental::parallel_transform(xs, f, executor) requires "
+            "'xs' to be a Sequence");
+        #endif
+
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            return parallel_detail::parallel_transform<S>(
+                static_cast<Xs&&>(xs), f, executor, std::make_index_sequence<N>{});
+        }
+
+        template <typename Xs, typename F>
+        auto operator()(Xs&& xs, F const& f) const
+        { return (*this)(static_cast<Xs&&>(xs), f, experimental::default_thread_pool()); }
+    };
+
+    constexpr parallel_transform_t parallel_transform{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#undef BOOST_HANA_EXPERIMENTAL_PARALLEL_EXCEPTIONS
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PARALLEL_HPP
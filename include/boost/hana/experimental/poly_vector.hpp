@@ -0,0 +1,145 @@
+/*
+@file
+Defines `boost::hana::experimental::poly_vector`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
+#define BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Container of objects of the types `T...`, stored by type.
+    //!
+    //! A `poly_vector` holds one `std::vector` per type, in a `hana::map`
+    //! from `type_c<T>` to `std::vector<T>`. An object is inserted at the
+    //! end of the segment of its type, and `for_each` visits the segments
+    //! one after the other. Hence, the function is called statically on
+    //! each type and the objects are traversed contiguously, which is much
+    //! faster than calling a virtual function through a vector of pointers
+    //! to a base class. In exchange, objects of different types are not
+    //! visited in insertion order; only the order of the objects of a same
+    //! type is preserved.
+    //!
+    //! The types `T...` must be distinct.
+    template <typename ...T>
+    class poly_vector {
+        using segments_type = hana::map<
+            hana::pair<hana::type<T>, std::vector<T>>...
+        >;
+        segments_type segments_;
+
+        template <typename U>
+        static constexpr bool holds() {
+            return decltype(hana::contains(std::declval<segments_type const&>(),
+                                           hana::type_c<U>))::value;
+        }
+
+    public:
+        //! Returns the vector holding the objects of type `U`.
+        template <typename U>
+        std::vector<U>& segment() {
+            static_assert(holds<U>(),
+            "hana::experimental::poly_vector::segment<U>() requires 'U' to be one of the types of the poly_vector");
+            return segments_[hana::type_c<U>];
+        }
+
+        template <typename U>
+        std::vector<U> const& segment() const {
+            static_assert(holds<U>(),
+            "hana::experimental::poly_vector::segment<U>() requires 'U' to be one of the types of the poly_vector");
+            return segments_[hana::type_c<U>];
+        }
+
+        //! Appends `x` to the segment of its decayed type.
+        template <typename X>
+        void insert(X&& x) {
+            using U = typename detail::decay<X>::type;
+            static_assert(holds<U>(),
+            "hana::experimental::poly_vector::insert(x) requires the type of 'x' to be one of the types of the poly_vector");
+            segments_[hana::type_c<U>].push_back(static_cast<X&&>(x));
+        }
+
+        //! Constructs an object of type `U` at the end of its segment, and
+        //! returns a reference to it.
+        template <typename U, typename ...Args>
+        U& emplace(Args&& ...args) {
+            std::vector<U>& seg = this->segment<U>();
+            seg.emplace_back(static_cast<Args&&>(args)...);
+            return seg.back();
+        }
+
+        //! Calls `f` on each object, segment by segment.
+        template <typename F>
+        void for_each(F&& f) {
+            hana::for_each(segments_, [&f](auto& p) {
+                for (auto& x : hana::second(p))
+                    f(x);
+            });
+        }
+
+        template <typename F>
+        void for_each(F&& f) const {
+            hana::for_each(segments_, [&f](auto const& p) {
+                for (auto const& x : hana::second(p))
+                    f(x);
+            });
+        }
+
+        //! Removes the objects satisfying `pred`, and returns the number of
+        //! removed objects. The order of the remaining objects is preserved.
+        template <typename Pred>
+        std::size_t erase_if(Pred&& pred) {
+            std::size_t erased = 0;
+            hana::for_each(segments_, [&](auto& p) {
+                auto& seg = hana::second(p);
+                auto last = std::remove_if(seg.begin(), seg.end(), [&](auto const& x) {
+                    return static_cast<bool>(pred(x));
+                });
+                erased += static_cast<std::size_t>(seg.end() - last);
+                seg.erase(last, seg.end());
+            });
+            return erased;
+        }
+
+        //! Returns the total number of objects.
+        std::size_t size() const {
+            std::size_t n = 0;
+            hana::for_each(segments_, [&n](auto const& p) {
+                n += hana::second(p).size();
+            });
+            return n;
+        }
+
+        bool empty() const
+        { return this->size() == 0; }
+
+        //! Removes all the objects, but keeps the capacity of each segment.
+        void clear() {
+            hana::for_each(segments_, [](auto& p) {
+                hana::second(p).clear();
+            });
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_POLY_VECTOR_HPP
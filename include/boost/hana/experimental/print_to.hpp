@@ -0,0 +1,280 @@
+/*
+@file
+Defines `boost::hana::experimental::print_to`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_PRINT_TO_HPP
+#define BOOST_HANA_EXPERIMENTAL_PRINT_TO_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/product.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/experimental/type_name.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/value.hpp>
+
+// models for different containers
+#include <boost/hana/fwd/map.hpp>
+#include <boost/hana/fwd/optional.hpp>
+#include <boost/hana/fwd/set.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/string_ref.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @cond
+    template <typename T, typename = void>
+    struct print_to_impl : print_to_impl<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct print_to_impl<T, hana::when<condition>> : hana::default_ {
+        template <typename ...Args>
+        static void apply(Args&& ...) = delete;
+    };
+    //! @endcond
+
+    namespace print_to_detail {
+        template <typename OutputIterator>
+        struct iterator_sink {
+            OutputIterator out;
+
+            void put(char c) {
+                *out = c;
+                ++out;
+            }
+
+            void write(char const* s, std::size_t n) {
+                for (std::size_t i = 0; i != n; ++i, ++out)
+                    *out = s[i];
+            }
+        };
+
+        template <typename Sink, typename X>
+        void print_one(Sink& sink, X const& x);
+
+        template <typename Sink, typename Xs>
+        void print_elements(Sink& sink, Xs const& xs) {
+            bool first = true;
+            hana::for_each(xs, [&](auto const& x) {
+                if (!first)
+                    sink.write(", ", 2);
+                first = false;
+                print_to_detail::print_one(sink, x);
+            });
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Writes a representation of an object to an output iterator or to a
+    //! fixed-size buffer.
+    //!
+    //! `print_to(out, x)` writes the characters representing `x` to the
+    //! output iterator `out`, and returns the iterator past the last written
+    //! character. `print_to(buffer, size, x)` writes at most `size - 1`
+    //! characters followed by a null terminator to `buffer`, and returns
+    //! the number of characters that would have been written if `size` had
+    //! been large enough, like `std::snprintf`.
+    //!
+    //! This is an alternative to `experimental::print` for when performance
+    //! matters: it never allocates, it does not create temporary strings when
+    //! printing nested containers, and type names are computed at compile-time
+    //! with `experimental::type_name`. It also does not require the rest of
+    //! Boost or RTTI, but it is only supported on the compilers supported by
+    //! `experimental::type_name`. The representation is the same as the one
+    //! of `experimental::print` for Hana's containers; other objects are
+    //! written like `experimental::format` does, and `Struct`s are written
+    //! as `{member: value, ...}`.
+    //!
+    //! Other types can be supported by specializing
+    //! `experimental::print_to_impl` or `experimental::format_impl` for their
+    //! tag.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto print_to = [](auto out, auto const& x) {
+        return tag-dispatched;
+    };
+#else
+    struct print_to_t {
+        template <typename OutputIterator, typename T>
+        OutputIterator operator()(OutputIterator out, T const& t) const {
+            print_to_detail::iterator_sink<OutputIterator> sink{out};
+            print_to_detail::print_one(sink, t);
+            return sink.out;
+        }
+
+        template <typename T>
+        std::size_t operator()(char* buffer, std::size_t size, T const& t) const {
+            format_detail::buffer_sink sink{buffer, size == 0 ? 0 : size - 1, 0};
+            print_to_detail::print_one(sink, t);
+            if (size != 0)
+                buffer[sink.size < size ? sink.size : size - 1] = '\0';
+            return sink.size;
+        }
+    };
+
+    constexpr print_to_t print_to{};
+#endif
+
+    template <typename Sink, typename X>
+    void print_to_detail::print_one(Sink& sink, X const& x) {
+        using Tag = typename hana::tag_of<X>::type;
+        constexpr bool has_print = !hana::is_default<print_to_impl<Tag>>::value;
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(has_print || Formattable<Tag>::value,
+        "hana::experimental::print_to(out, x) requires 'x' to be printable; "
+        "specialize hana::experimental::print_to_impl or "
+        "hana::experimental::format_impl for its tag");
+    #endif
+
+        using Print = typename std::conditional<has_print,
+            print_to_impl<Tag>, format_impl<Tag>
+        >::type;
+        Print::apply(sink, x);
+    }
+
+    // model for Sequences
+    template <typename S>
+    struct print_to_impl<S, hana::when<hana::Sequence<S>::value>> {
+        template <typename Sink, typename Xs>
+        static void apply(Sink& sink, Xs const& xs) {
+            sink.put('(');
+            print_to_detail::print_elements(sink, xs);
+            sink.put(')');
+        }
+    };
+
+    // model for hana::optional
+    template <>
+    struct print_to_impl<hana::optional_tag> {
+        template <typename Sink>
+        static void apply(Sink& sink, hana::optional<> const&)
+        { sink.write("nothing", 7); }
+
+        template <typename Sink, typename T>
+        static void apply(Sink& sink, hana::optional<T> const& optional) {
+            sink.write("just(", 5);
+            print_to_detail::print_one(sink, *optional);
+            sink.put(')');
+        }
+    };
+
+    // model for hana::maps
+    template <>
+    struct print_to_impl<hana::map_tag> {
+        template <typename Sink, typename M>
+        static void apply(Sink& sink, M const& map) {
+            bool first = true;
+            sink.put('{');
+            hana::for_each(map, [&](auto const& pair) {
+                if (!first)
+                    sink.write(", ", 2);
+                first = false;
+                print_to_detail::print_one(sink, hana::first(pair));
+                sink.write(" => ", 4);
+                print_to_detail::print_one(sink, hana::second(pair));
+            });
+            sink.put('}');
+        }
+    };
+
+    // model for hana::sets
+    template <>
+    struct print_to_impl<hana::set_tag> {
+        template <typename Sink, typename S>
+        static void apply(Sink& sink, S const& set) {
+            sink.put('{');
+            print_to_detail::print_elements(sink, set);
+            sink.put('}');
+        }
+    };
+
+    // model for Constants holding a printable object
+    template <typename C>
+    struct print_to_impl<C, hana::when<hana::Constant<C>::value>> {
+        template <typename Sink, typename T>
+        static void apply(Sink& sink, T const&) {
+            constexpr auto value = hana::value<T>();
+            print_to_detail::print_one(sink, value);
+        }
+    };
+
+    // model for Products
+    template <typename P>
+    struct print_to_impl<P, hana::when<hana::Product<P>::value>> {
+        template <typename Sink, typename T>
+        static void apply(Sink& sink, T const& t) {
+            sink.put('(');
+            print_to_detail::print_one(sink, hana::first(t));
+            sink.write(", ", 2);
+            print_to_detail::print_one(sink, hana::second(t));
+            sink.put(')');
+        }
+    };
+
+    // model for Structs
+    template <typename S>
+    struct print_to_impl<S, hana::when<hana::Struct<S>::value>> {
+        template <typename Sink, typename X>
+        static void apply(Sink& sink, X const& x) {
+            bool first = true;
+            sink.put('{');
+            hana::for_each(hana::accessors<S>(), [&](auto const& accessor) {
+                if (!first)
+                    sink.write(", ", 2);
+                first = false;
+                format_impl<hana::string_tag>::apply(sink, hana::first(accessor));
+                sink.write(": ", 2);
+                print_to_detail::print_one(sink, hana::second(accessor)(x));
+            });
+            sink.put('}');
+        }
+    };
+
+    // model for compile-time strings
+    template <>
+    struct print_to_impl<hana::string_tag> {
+        template <typename Sink, typename S>
+        static void apply(Sink& sink, S const& s) {
+            sink.put('"');
+            format_impl<hana::string_tag>::apply(sink, s);
+            sink.put('"');
+        }
+    };
+
+    template <>
+    struct print_to_impl<hana::string_ref_tag>
+        : print_to_impl<hana::string_tag>
+    { };
+
+    // model for hana::types
+    template <>
+    struct print_to_impl<hana::type_tag> {
+        template <typename Sink, typename T>
+        static void apply(Sink& sink, T const&) {
+            constexpr auto name = detail::type_name_impl2<typename T::type>();
+            sink.write("type<", 5);
+            sink.write(name.ptr, name.length);
+            sink.put('>');
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_PRINT_TO_HPP
@@ -0,0 +1,704 @@
+/*
+@file
+Defines `boost::hana::experimental::regex`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_REGEX_HPP
+#define BOOST_HANA_EXPERIMENTAL_REGEX_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace regex_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Sets of characters
+        //////////////////////////////////////////////////////////////////////
+        struct charset {
+            std::uint64_t bits[4];
+
+            constexpr void add(unsigned char c)
+            { bits[c / 64] |= std::uint64_t{1} << (c % 64); }
+
+            constexpr void add(unsigned char lo, unsigned char hi) {
+                for (unsigned c = lo; c <= hi; ++c)
+                    add(static_cast<unsigned char>(c));
+            }
+
+            constexpr void add(charset const& other) {
+                for (std::size_t i = 0; i != 4; ++i)
+                    bits[i] |= other.bits[i];
+            }
+
+            constexpr void negate() {
+                for (std::size_t i = 0; i != 4; ++i)
+                    bits[i] = ~bits[i];
+            }
+
+            constexpr bool contains(unsigned char c) const
+            { return (bits[c / 64] >> (c % 64)) & 1; }
+        };
+
+        constexpr charset single(unsigned char c) {
+            charset set{};
+            set.add(c);
+            return set;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Thompson NFA
+        //////////////////////////////////////////////////////////////////////
+        // `epsilon` states have a single epsilon transition to `out1`,
+        // `split` states have two epsilon transitions to `out1` and `out2`,
+        // and `chars` states have a transition to `out1` on the characters
+        // of `set`.
+        enum state_kind : unsigned char { epsilon, split, chars, match };
+
+        struct nfa_state {
+            state_kind kind;
+            std::size_t out1;
+            std::size_t out2;
+            charset set;
+        };
+
+        template <std::size_t Capacity>
+        struct nfa {
+            nfa_state states[Capacity > 0 ? Capacity : 1];
+            std::size_t size;
+            std::size_t start;
+
+            constexpr std::size_t add(state_kind kind, charset set,
+                                      std::size_t out1, std::size_t out2)
+            {
+                states[size] = nfa_state{kind, out1, out2, set};
+                return size++;
+            }
+
+            constexpr void patch(std::size_t state, std::size_t target)
+            { states[state].out1 = target; }
+
+            constexpr void make_split(std::size_t state, std::size_t out1,
+                                      std::size_t out2)
+            {
+                states[state].kind = split;
+                states[state].out1 = out1;
+                states[state].out2 = out2;
+            }
+        };
+
+        // Used to find the number of states of the NFA before building it.
+        struct nfa_counter {
+            std::size_t size;
+            std::size_t start;
+
+            constexpr std::size_t add(state_kind, charset, std::size_t, std::size_t)
+            { return size++; }
+
+            constexpr void patch(std::size_t, std::size_t) { }
+            constexpr void make_split(std::size_t, std::size_t, std::size_t) { }
+        };
+
+        enum error_kind : unsigned char {
+            no_error,
+            unbalanced_parenthesis,
+            nothing_to_repeat,
+            unterminated_class,
+            invalid_range,
+            trailing_backslash,
+            invalid_repetition,
+            misplaced_anchor
+        };
+
+        constexpr std::size_t unbounded = static_cast<std::size_t>(-1);
+
+        // Recursive descent parser for the pattern, which builds the NFA in
+        // `Nfa`. Each parsing function returns a fragment of the NFA, which
+        // goes from the `start` state to the `end` state. The `end` state is
+        // always an `epsilon` state whose transition is patched later.
+        template <typename Nfa>
+        struct parser {
+            char const* pattern;
+            std::size_t length;
+            std::size_t pos;
+            Nfa* nfa;
+            error_kind error;
+
+            struct fragment { std::size_t start, end; };
+
+            constexpr bool done() const
+            { return pos == length || error != no_error; }
+
+            constexpr fragment fail(error_kind e) {
+                if (error == no_error)
+                    error = e;
+                pos = length;
+                return empty();
+            }
+
+            constexpr fragment empty() {
+                std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                return {e, e};
+            }
+
+            constexpr fragment set(charset const& s) {
+                std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                return {nfa->add(chars, s, e, 0), e};
+            }
+
+            constexpr fragment concat(fragment a, fragment b) {
+                nfa->patch(a.end, b.start);
+                return {a.start, b.end};
+            }
+
+            constexpr fragment optional(fragment a) {
+                std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                std::size_t s = nfa->add(split, charset{}, a.start, e);
+                nfa->patch(a.end, e);
+                return {s, e};
+            }
+
+            constexpr fragment star(fragment a) {
+                std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                std::size_t s = nfa->add(split, charset{}, a.start, e);
+                nfa->make_split(a.end, a.start, e);
+                return {s, e};
+            }
+
+            constexpr fragment plus(fragment a) {
+                std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                nfa->make_split(a.end, a.start, e);
+                return {a.start, e};
+            }
+
+            constexpr fragment parse() {
+                fragment f = parse_alternation();
+                if (pos != length)
+                    return fail(unbalanced_parenthesis);
+                return f;
+            }
+
+            constexpr fragment parse_alternation() {
+                fragment f = parse_concatenation();
+                while (!done() && pattern[pos] == '|') {
+                    ++pos;
+                    fragment g = parse_concatenation();
+                    std::size_t e = nfa->add(epsilon, charset{}, 0, 0);
+                    std::size_t s = nfa->add(split, charset{}, f.start, g.start);
+                    nfa->patch(f.end, e);
+                    nfa->patch(g.end, e);
+                    f = {s, e};
+                }
+                return f;
+            }
+
+            constexpr fragment parse_concatenation() {
+                fragment f = empty();
+                while (!done() && pattern[pos] != '|' && pattern[pos] != ')')
+                    f = concat(f, parse_repetition());
+                return f;
+            }
+
+            constexpr std::size_t parse_number() {
+                std::size_t n = 0;
+                if (pos == length || pattern[pos] < '0' || pattern[pos] > '9')
+                    return unbounded;
+                while (pos != length && pattern[pos] >= '0' && pattern[pos] <= '9')
+                    n = n * 10 + static_cast<std::size_t>(pattern[pos++] - '0');
+                return n;
+            }
+
+            // Parses the atom at `begin` again, to repeat it `{m,n}` times.
+            constexpr fragment reparse_atom(std::size_t begin) {
+                std::size_t current = pos;
+                pos = begin;
+                fragment f = parse_atom();
+                pos = current;
+                return f;
+            }
+
+            constexpr fragment parse_repetition() {
+                std::size_t begin = pos;
+                fragment f = parse_atom();
+                if (done())
+                    return f;
+
+                char c = pattern[pos];
+                if (c == '*')      { ++pos; f = star(f); }
+                else if (c == '+') { ++pos; f = plus(f); }
+                else if (c == '?') { ++pos; f = optional(f); }
+                else if (c == '{') {
+                    ++pos;
+                    std::size_t min = parse_number(), max = min;
+                    if (pos != length && pattern[pos] == ',') {
+                        ++pos;
+                        max = parse_number();
+                    }
+                    if (min == unbounded || pos == length || pattern[pos] != '}' ||
+                        (max != unbounded && max < min))
+                        return fail(invalid_repetition);
+                    ++pos;
+
+                    fragment result = empty();
+                    bool used = false;
+                    for (std::size_t i = 0; i != min; ++i) {
+                        result = concat(result, used ? reparse_atom(begin) : f);
+                        used = true;
+                    }
+                    if (max == unbounded)
+                        result = concat(result, star(used ? reparse_atom(begin) : f));
+                    for (std::size_t i = min; max != unbounded && i != max; ++i) {
+                        result = concat(result, optional(used ? reparse_atom(begin) : f));
+                        used = true;
+                    }
+                    f = result;
+                }
+                else {
+                    return f;
+                }
+
+                // Lazy quantifiers match the same strings as greedy ones,
+                // since we only match whole strings.
+                if (pos != length && pattern[pos] == '?')
+                    ++pos;
+                if (pos != length && (pattern[pos] == '*' || pattern[pos] == '+' ||
+                                      pattern[pos] == '?' || pattern[pos] == '{'))
+                    return fail(nothing_to_repeat);
+                return f;
+            }
+
+            // Parses the escape sequence after a backslash. If it denotes a
+            // single character, it is also stored in `c`.
+            constexpr charset parse_escape(int& c) {
+                if (pos == length) {
+                    fail(trailing_backslash);
+                    return charset{};
+                }
+                char e = pattern[pos++];
+                charset s{};
+                c = -1;
+                switch (e) {
+                case 'd': case 'D':
+                    s.add('0', '9');
+                    break;
+                case 'w': case 'W':
+                    s.add('a', 'z'); s.add('A', 'Z'); s.add('0', '9'); s.add('_');
+                    break;
+                case 's': case 'S':
+                    s.add(' '); s.add('\t'); s.add('\n');
+                    s.add('\r'); s.add('\f'); s.add('\v');
+                    break;
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'f': c = '\f'; break;
+                case 'v': c = '\v'; break;
+                case '0': c = '\0'; break;
+                default:  c = static_cast<unsigned char>(e); break;
+                }
+                if (e == 'D' || e == 'W' || e == 'S')
+                    s.negate();
+                if (c != -1)
+                    s.add(static_cast<unsigned char>(c));
+                return s;
+            }
+
+            constexpr fragment parse_class() {
+                charset s{};
+                bool negated = false;
+                if (pos != length && pattern[pos] == '^') {
+                    negated = true;
+                    ++pos;
+                }
+                while (true) {
+                    if (pos == length)
+                        return fail(unterminated_class);
+                    if (pattern[pos] == ']')
+                        break;
+
+                    int lo = static_cast<unsigned char>(pattern[pos++]);
+                    charset item = single(static_cast<unsigned char>(lo));
+                    if (lo == '\\')
+                        item = parse_escape(lo);
+                    if (error != no_error)
+                        return empty();
+
+                    if (lo != -1 && pos + 1 < length && pattern[pos] == '-' &&
+                                                        pattern[pos + 1] != ']')
+                    {
+                        ++pos;
+                        int hi = static_cast<unsigned char>(pattern[pos++]);
+                        if (hi == '\\') {
+                            parse_escape(hi);
+                            if (error != no_error)
+                                return empty();
+                        }
+                        if (hi == -1 || hi < lo)
+                            return fail(invalid_range);
+                        item.add(static_cast<unsigned char>(lo),
+                                 static_cast<unsigned char>(hi));
+                    }
+                    s.add(item);
+                }
+                ++pos;
+                if (negated)
+                    s.negate();
+                return set(s);
+            }
+
+            constexpr fragment parse_atom() {
+                char c = pattern[pos];
+                switch (c) {
+                case '(': {
+                    ++pos;
+                    if (pos + 1 < length && pattern[pos] == '?' && pattern[pos + 1] == ':')
+                        pos += 2;
+                    fragment f = parse_alternation();
+                    if (pos == length || pattern[pos] != ')')
+                        return fail(unbalanced_parenthesis);
+                    ++pos;
+                    return f;
+                }
+
+                case '*': case '+': case '?': case '{':
+                    return fail(nothing_to_repeat);
+
+                case '[':
+                    ++pos;
+                    return parse_class();
+
+                case '.': {
+                    ++pos;
+                    charset s = single('\n');
+                    s.add('\r');
+                    s.negate();
+                    return set(s);
+                }
+
+                case '\\': {
+                    ++pos;
+                    int single_char = -1;
+                    charset s = parse_escape(single_char);
+                    return error != no_error ? empty() : set(s);
+                }
+
+                // Since the whole string is always matched, anchors are
+                // only allowed where they are always satisfied.
+                case '^':
+                    if (pos != 0)
+                        return fail(misplaced_anchor);
+                    ++pos;
+                    return empty();
+
+                case '$':
+                    if (pos + 1 != length)
+                        return fail(misplaced_anchor);
+                    ++pos;
+                    return empty();
+
+                default:
+                    ++pos;
+                    return set(single(static_cast<unsigned char>(c)));
+                }
+            }
+        };
+
+        template <typename P>
+        constexpr nfa_counter count_nfa() {
+            nfa_counter counter{0, 0};
+            parser<nfa_counter> p{P::get(), detail::string_ref_length<P>, 0, &counter, no_error};
+            p.parse();
+            counter.add(match, charset{}, 0, 0);
+            return counter;
+        }
+
+        template <typename P>
+        struct parse_result {
+            static constexpr std::size_t states = regex_detail::count_nfa<P>().size;
+            nfa<states> automaton;
+            error_kind error;
+        };
+
+        template <typename P>
+        constexpr parse_result<P> make_nfa() {
+            parse_result<P> result{{}, no_error};
+            parser<nfa<parse_result<P>::states>> p{
+                P::get(), detail::string_ref_length<P>, 0, &result.automaton, no_error
+            };
+            auto f = p.parse();
+            std::size_t m = result.automaton.add(match, charset{}, 0, 0);
+            result.automaton.patch(f.end, m);
+            result.automaton.start = f.start;
+            result.error = p.error;
+            return result;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Classes of equivalent characters
+        //////////////////////////////////////////////////////////////////////
+        // Two characters are equivalent if they belong to the same sets in
+        // the NFA, in which case they lead to the same transitions. The
+        // DFA has one column per class instead of one per character.
+        struct byte_classes {
+            unsigned char of[256];
+            unsigned char representative[256];
+            std::size_t count;
+        };
+
+        template <std::size_t N>
+        constexpr bool equivalent(nfa<N> const& a, unsigned char x, unsigned char y) {
+            for (std::size_t i = 0; i != a.size; ++i)
+                if (a.states[i].kind == chars &&
+                    a.states[i].set.contains(x) != a.states[i].set.contains(y))
+                    return false;
+            return true;
+        }
+
+        template <std::size_t N>
+        constexpr byte_classes make_byte_classes(nfa<N> const& a) {
+            byte_classes classes{{}, {}, 0};
+            for (unsigned c = 0; c != 256; ++c) {
+                std::size_t k = 0;
+                while (k != classes.count &&
+                       !regex_detail::equivalent(a, static_cast<unsigned char>(c),
+                                                    classes.representative[k]))
+                    ++k;
+                if (k == classes.count)
+                    classes.representative[classes.count++] = static_cast<unsigned char>(c);
+                classes.of[c] = static_cast<unsigned char>(k);
+            }
+            return classes;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Subset construction
+        //////////////////////////////////////////////////////////////////////
+        // State 0 of the DFA is the dead state, whose set of NFA states is
+        // empty, and state 1 is the start state.
+        constexpr std::size_t max_dfa_states = 256;
+
+        template <std::size_t N>
+        struct state_set {
+            std::uint64_t bits[(N + 63) / 64];
+
+            constexpr bool contains(std::size_t i) const
+            { return (bits[i / 64] >> (i % 64)) & 1; }
+
+            constexpr void add(std::size_t i)
+            { bits[i / 64] |= std::uint64_t{1} << (i % 64); }
+
+            constexpr bool operator==(state_set const& other) const {
+                for (std::size_t i = 0; i != (N + 63) / 64; ++i)
+                    if (bits[i] != other.bits[i])
+                        return false;
+                return true;
+            }
+        };
+
+        template <std::size_t N>
+        constexpr void close(nfa<N> const& a, state_set<N>& set) {
+            std::size_t stack[N] = {};
+            std::size_t top = 0;
+            for (std::size_t i = 0; i != a.size; ++i)
+                if (set.contains(i))
+                    stack[top++] = i;
+            while (top != 0) {
+                nfa_state const& s = a.states[stack[--top]];
+                if (s.kind == epsilon || s.kind == split) {
+                    if (!set.contains(s.out1)) {
+                        set.add(s.out1);
+                        stack[top++] = s.out1;
+                    }
+                }
+                if (s.kind == split) {
+                    if (!set.contains(s.out2)) {
+                        set.add(s.out2);
+                        stack[top++] = s.out2;
+                    }
+                }
+            }
+        }
+
+        template <std::size_t N, std::size_t Classes>
+        struct subsets {
+            state_set<N> sets[max_dfa_states];
+            unsigned char next[max_dfa_states * Classes];
+            std::size_t count;
+            bool overflow;
+        };
+
+        template <std::size_t N, std::size_t Classes>
+        constexpr subsets<N, Classes>
+        make_subsets(nfa<N> const& a, byte_classes const& classes) {
+            subsets<N, Classes> result{{}, {}, 2, false};
+            result.sets[1].add(a.start);
+            regex_detail::close(a, result.sets[1]);
+
+            for (std::size_t s = 1; s != result.count; ++s) {
+                for (std::size_t k = 0; k != Classes; ++k) {
+                    state_set<N> target{};
+                    for (std::size_t i = 0; i != a.size; ++i)
+                        if (result.sets[s].contains(i) && a.states[i].kind == chars &&
+                            a.states[i].set.contains(classes.representative[k]))
+                            target.add(a.states[i].out1);
+                    regex_detail::close(a, target);
+
+                    std::size_t t = 0;
+                    while (t != result.count && !(result.sets[t] == target))
+                        ++t;
+                    if (t == result.count) {
+                        if (result.count == max_dfa_states) {
+                            result.overflow = true;
+                            return result;
+                        }
+                        result.sets[result.count++] = target;
+                    }
+                    result.next[s * Classes + k] = static_cast<unsigned char>(t);
+                }
+            }
+            return result;
+        }
+
+        // The DFA, with exactly as many states and classes as needed.
+        template <std::size_t States, std::size_t Classes>
+        struct dfa {
+            unsigned char classes[256];
+            unsigned char next[States * Classes];
+            bool accepts[States];
+        };
+
+        template <typename P>
+        struct compiled {
+            static constexpr parse_result<P> parsed = regex_detail::make_nfa<P>();
+            static constexpr std::size_t nfa_states = parse_result<P>::states;
+
+            static_assert(parsed.error != unbalanced_parenthesis,
+            "hana::experimental::regex: unbalanced parenthesis in the pattern");
+            static_assert(parsed.error != nothing_to_repeat,
+            "hana::experimental::regex: a quantifier in the pattern has nothing to repeat");
+            static_assert(parsed.error != unterminated_class,
+            "hana::experimental::regex: unterminated character class in the pattern");
+            static_assert(parsed.error != invalid_range,
+            "hana::experimental::regex: invalid range in a character class of the pattern");
+            static_assert(parsed.error != trailing_backslash,
+            "hana::experimental::regex: the pattern ends with a backslash");
+            static_assert(parsed.error != invalid_repetition,
+            "hana::experimental::regex: invalid repetition count in the pattern");
+            static_assert(parsed.error != misplaced_anchor,
+            "hana::experimental::regex: '^' and '$' may only appear at the beginning and at the end of the pattern");
+
+            static constexpr byte_classes classes =
+                regex_detail::make_byte_classes(parsed.automaton);
+            static constexpr std::size_t class_count = classes.count;
+
+            static constexpr subsets<nfa_states, class_count> subset =
+                regex_detail::make_subsets<nfa_states, class_count>(parsed.automaton, classes);
+
+            static_assert(!subset.overflow,
+            "hana::experimental::regex: the pattern requires too many states");
+
+            static constexpr std::size_t states = subset.count;
+
+            static constexpr dfa<states, class_count> make_dfa() {
+                dfa<states, class_count> result{{}, {}, {}};
+                for (std::size_t c = 0; c != 256; ++c)
+                    result.classes[c] = classes.of[c];
+                for (std::size_t i = 0; i != states * class_count; ++i)
+                    result.next[i] = subset.next[i];
+                std::size_t accept = parsed.automaton.size - 1;
+                for (std::size_t s = 0; s != states; ++s)
+                    result.accepts[s] = subset.sets[s].contains(accept);
+                return result;
+            }
+
+            static constexpr dfa<states, class_count> automaton = make_dfa();
+        };
+
+        template <typename P>
+        constexpr parse_result<P> compiled<P>::parsed;
+
+        template <typename P>
+        constexpr byte_classes compiled<P>::classes;
+
+        template <typename P>
+        constexpr subsets<compiled<P>::nfa_states, compiled<P>::class_count>
+        compiled<P>::subset;
+
+        template <typename P>
+        constexpr dfa<compiled<P>::states, compiled<P>::class_count>
+        compiled<P>::automaton;
+    }
+
+    //! @ingroup group-experimental
+    //! Regular expression whose pattern is a compile-time string.
+    //!
+    //! The pattern is parsed at compile-time and turned into a deterministic
+    //! finite automaton, whose transitions are stored in a `constexpr` table.
+    //! Matching a string at runtime is then a single loop doing one table
+    //! lookup per character, without any allocation or backtracking. A
+    //! `regex` is created with `experimental::make_regex(pattern)`.
+    //!
+    //! The pattern uses a subset of the ECMAScript syntax of `std::regex`:
+    //! literal characters, `.`, character classes like `[a-z_]` and
+    //! `[^0-9]`, the escapes `\d`, `\w`, `\s` and their negations, groups
+    //! `(...)` and `(?:...)`, alternation `|`, and the quantifiers `*`, `+`,
+    //! `?`, `{m}`, `{m,}` and `{m,n}`. Backreferences and assertions are not
+    //! supported. An invalid pattern triggers a `static_assert`.
+    //!
+    //! `match(s)` returns whether the whole string `s` matches the pattern,
+    //! like `std::regex_match`. `s` may be a null-terminated string, a pair
+    //! of iterators or any object with `data()` and `size()`.
+    template <typename P>
+    struct regex {
+        template <typename Iterator>
+        constexpr bool match(Iterator first, Iterator last) const {
+            using Compiled = regex_detail::compiled<P>;
+            constexpr std::size_t classes = Compiled::class_count;
+            auto const& dfa = Compiled::automaton;
+            std::size_t state = 1;
+            for (; first != last; ++first) {
+                state = dfa.next[state * classes +
+                                 dfa.classes[static_cast<unsigned char>(*first)]];
+                if (state == 0)
+                    return false;
+            }
+            return dfa.accepts[state];
+        }
+
+        bool match(char const* s) const
+        { return this->match(s, s + std::strlen(s)); }
+
+        template <typename String>
+        constexpr auto match(String const& s) const
+            -> decltype((void)s.data(), (void)s.size(), true)
+        { return this->match(s.data(), s.data() + s.size()); }
+    };
+
+    //! @ingroup group-experimental
+    //! Creates an `experimental::regex` from a compile-time string.
+    struct make_regex_t {
+        template <typename S>
+        constexpr auto operator()(S const&) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(detail::is_compile_time_string<S>::value,
+            "hana::experimental::make_regex(pattern) requires 'pattern' to be a compile-time string");
+        #endif
+            return regex<typename detail::string_array<S>::type>{};
+        }
+    };
+
+    constexpr make_regex_t make_regex{};
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_REGEX_HPP
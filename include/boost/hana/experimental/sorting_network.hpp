@@ -0,0 +1,207 @@
+/*
+@file
+Defines `boost::hana::experimental::sorting_network`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SORTING_NETWORK_HPP
+#define BOOST_HANA_EXPERIMENTAL_SORTING_NETWORK_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace sorting_network_detail {
+        // Emits the comparators of a network sorting `n` elements. For
+        // `n <= 8`, these are the networks with the fewest comparators.
+        // Otherwise, this is Batcher's merge exchange (Knuth's Algorithm
+        // 5.2.2M), which works for any `n`.
+        template <typename Emit>
+        constexpr void make_network(std::size_t n, Emit& emit) {
+            switch (n) {
+            case 0: case 1:
+                return;
+            case 2:
+                emit(0, 1);
+                return;
+            case 3:
+                emit(0, 2); emit(0, 1); emit(1, 2);
+                return;
+            case 4:
+                emit(0, 2); emit(1, 3); emit(0, 1); emit(2, 3); emit(1, 2);
+                return;
+            case 5:
+                emit(0, 3); emit(1, 4); emit(0, 2); emit(1, 3); emit(0, 1);
+                emit(2, 4); emit(1, 2); emit(3, 4); emit(2, 3);
+                return;
+            case 6:
+                emit(0, 5); emit(1, 3); emit(2, 4); emit(1, 2); emit(3, 4);
+                emit(0, 3); emit(2, 5); emit(0, 1); emit(2, 3); emit(4, 5);
+                emit(1, 2); emit(3, 4);
+                return;
+            case 7:
+                emit(0, 6); emit(2, 3); emit(4, 5); emit(0, 2); emit(1, 4);
+                emit(3, 6); emit(0, 1); emit(2, 5); emit(3, 4); emit(1, 2);
+                emit(4, 6); emit(2, 3); emit(4, 5); emit(1, 2); emit(3, 4);
+                emit(5, 6);
+                return;
+            case 8:
+                emit(0, 2); emit(1, 3); emit(4, 6); emit(5, 7); emit(0, 4);
+                emit(1, 5); emit(2, 6); emit(3, 7); emit(0, 1); emit(2, 3);
+                emit(4, 5); emit(6, 7); emit(2, 4); emit(3, 5); emit(1, 4);
+                emit(3, 6); emit(1, 2); emit(3, 4); emit(5, 6);
+                return;
+            default:
+                break;
+            }
+
+            std::size_t t = 0;
+            while ((std::size_t{1} << t) < n)
+                ++t;
+            for (std::size_t p = std::size_t{1} << (t - 1); p > 0; p /= 2) {
+                std::size_t q = std::size_t{1} << (t - 1), r = 0, d = p;
+                while (true) {
+                    for (std::size_t i = 0; i + d < n; ++i)
+                        if ((i & p) == r)
+                            emit(i, i + d);
+                    if (q == p)
+                        break;
+                    d = q - p;
+                    q /= 2;
+                    r = p;
+                }
+            }
+        }
+
+        struct count_comparators {
+            std::size_t count;
+            constexpr void operator()(std::size_t, std::size_t)
+            { ++count; }
+        };
+
+        template <std::size_t N>
+        constexpr std::size_t comparators() {
+            count_comparators c{0};
+            sorting_network_detail::make_network(N, c);
+            return c.count;
+        }
+
+        template <std::size_t Size>
+        struct comparator_table {
+            detail::array<std::size_t, Size> lo;
+            detail::array<std::size_t, Size> hi;
+            std::size_t count;
+
+            constexpr void operator()(std::size_t i, std::size_t j) {
+                lo[count] = i;
+                hi[count] = j;
+                ++count;
+            }
+        };
+
+        template <std::size_t N>
+        constexpr auto make_table() {
+            comparator_table<sorting_network_detail::comparators<N>()> table{{}, {}, 0};
+            sorting_network_detail::make_network(N, table);
+            return table;
+        }
+
+        // The minimum and the maximum are computed with two independent
+        // comparisons, which compilers turn into `min` and `max` instructions
+        // or conditional moves. With a single comparison, GCC emits a branch
+        // for floating point types.
+        template <typename T>
+        constexpr void compare_exchange(T& x, T& y) {
+            T const a = x;
+            T const b = y;
+            T const lo = b < a ? b : a;
+            T const hi = a < b ? b : a;
+            x = lo;
+            y = hi;
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Sorts `N` arithmetic values with a sorting network generated at
+    //! compile-time.
+    //!
+    //! A sorting network is a fixed sequence of compare-exchange operations
+    //! which sorts any input. Since the sequence is known at compile-time,
+    //! `sorting_network<N>::sort(xs)` unrolls it completely and performs each
+    //! compare-exchange with a `min` and a `max`, without any branch. For
+    //! small arrays, this is much faster than `std::sort`, which must branch
+    //! on the data.
+    //!
+    //! For `N <= 8`, the network has the smallest known number of
+    //! comparators. Otherwise, Batcher's merge exchange is used, which
+    //! requires `O(N log^2 N)` comparators. `xs` must be a `std::array<T, N>`
+    //! or a `hana::tuple` of `N` elements of the same type `T`, and `T` must
+    //! be an arithmetic type.
+    template <std::size_t N>
+    struct sorting_network {
+        //! The number of compare-exchange operations in the network.
+        static constexpr std::size_t comparators =
+            sorting_network_detail::comparators<N>();
+
+        template <typename T>
+        static void sort(std::array<T, N>& xs) {
+            static_assert(std::is_arithmetic<T>{},
+            "hana::experimental::sorting_network<N>::sort(xs) requires the elements of 'xs' to be arithmetic");
+            sorting_network::apply(xs, std::make_index_sequence<comparators>{});
+        }
+
+        template <typename T, typename ...U>
+        static constexpr void sort(hana::tuple<T, U...>& xs) {
+            static_assert(sizeof...(U) + 1 == N,
+            "hana::experimental::sorting_network<N>::sort(xs) requires 'xs' to have N elements");
+            static_assert(detail::fast_and<std::is_same<T, U>::value...>::value,
+            "hana::experimental::sorting_network<N>::sort(xs) requires the elements of 'xs' to have the same type");
+            static_assert(std::is_arithmetic<T>{},
+            "hana::experimental::sorting_network<N>::sort(xs) requires the elements of 'xs' to be arithmetic");
+            sorting_network::apply(xs, std::make_index_sequence<comparators>{});
+        }
+
+        static constexpr void sort(hana::tuple<>&) { }
+
+    private:
+        static constexpr sorting_network_detail::comparator_table<comparators>
+            table = sorting_network_detail::make_table<N>();
+
+        template <std::size_t i, typename T>
+        static T& get(std::array<T, N>& xs) { return std::get<i>(xs); }
+
+        template <std::size_t i, typename ...T>
+        static constexpr decltype(auto) get(hana::tuple<T...>& xs)
+        { return hana::at_c<i>(xs); }
+
+        template <typename Xs, std::size_t ...k>
+        static constexpr void apply(Xs& xs, std::index_sequence<k...>) {
+            using Swallow = int[];
+            (void)Swallow{0, (sorting_network_detail::compare_exchange(
+                sorting_network::get<table.lo[k]>(xs),
+                sorting_network::get<table.hi[k]>(xs)
+            ), 0)...};
+        }
+    };
+
+    template <std::size_t N>
+    constexpr std::size_t sorting_network<N>::comparators;
+
+    template <std::size_t N>
+    constexpr sorting_network_detail::comparator_table<sorting_network<N>::comparators>
+        sorting_network<N>::table;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SORTING_NETWORK_HPP
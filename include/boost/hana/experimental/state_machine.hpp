@@ -0,0 +1,440 @@
+/*
+@file
+Defines `boost::hana::experimental::state_machine`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
+#define BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Action that does nothing, used by transitions without an action.
+    struct no_action_t {
+        template <typename ...T>
+        constexpr void operator()(T const& ...) const { }
+    };
+
+    constexpr no_action_t no_action{};
+
+    //! @ingroup group-experimental
+    //! Creates a transition of an `experimental::state_machine`.
+    //!
+    //! `transition(from, event, action, to)` is the transition from the
+    //! state `from` to the state `to` on the event `event`, which calls
+    //! `action` when it is taken. States and events must be `hana::type`s
+    //! or `IntegralConstant`s. The transition is represented as
+    //! `hana::pair(hana::pair(from, event), hana::pair(action, to))`, so a
+    //! sequence of such pairs may also be written by hand.
+    struct transition_t {
+        template <typename From, typename Event, typename Action, typename To>
+        constexpr auto operator()(From from, Event event, Action action, To to) const {
+            return hana::make_pair(hana::make_pair(from, event),
+                                   hana::make_pair(action, to));
+        }
+
+        template <typename From, typename Event, typename To>
+        constexpr auto operator()(From from, Event event, To to) const
+        { return (*this)(from, event, no_action, to); }
+    };
+
+    constexpr transition_t transition{};
+
+    namespace state_machine_detail {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        template <typename T, typename ...U>
+        constexpr std::size_t index_of() {
+            constexpr bool same[] = {false, std::is_same<T, U>::value...};
+            for (std::size_t i = 1; i != sizeof...(U) + 1; ++i)
+                if (same[i])
+                    return i - 1;
+            return npos;
+        }
+
+        // Removes the duplicate types, keeping the first occurrence of each.
+        template <typename Result, typename ...T>
+        struct unique;
+
+        template <typename ...R>
+        struct unique<types<R...>> {
+            using type = types<R...>;
+        };
+
+        template <typename ...R, typename T, typename ...Rest>
+        struct unique<types<R...>, T, Rest...>
+            : unique<typename std::conditional<
+                state_machine_detail::index_of<T, R...>() == npos,
+                types<R..., T>, types<R...>
+            >::type, Rest...>
+        { };
+
+        template <typename T>
+        struct is_key
+            : std::integral_constant<bool,
+                std::is_same<typename hana::tag_of<T>::type, hana::type_tag>::value ||
+                hana::Constant<T>::value
+            >
+        { };
+
+        template <typename Transition>
+        struct transition_traits {
+            using from = typename std::decay<decltype(
+                hana::first(hana::first(std::declval<Transition>())))>::type;
+            using event = typename std::decay<decltype(
+                hana::second(hana::first(std::declval<Transition>())))>::type;
+            using to = typename std::decay<decltype(
+                hana::second(hana::second(std::declval<Transition>())))>::type;
+        };
+
+        // The dense table of the state machine maps each (state, event) to
+        // the index of its transition, or to `npos` if there is none.
+        template <std::size_t States, std::size_t Events>
+        struct table {
+            detail::array<std::size_t, States * Events> transition;
+            bool duplicate;
+        };
+
+        template <std::size_t States, std::size_t Events, std::size_t N>
+        constexpr table<States, Events>
+        make_table(detail::array<std::size_t, N> const& from,
+                   detail::array<std::size_t, N> const& event)
+        {
+            table<States, Events> t{{}, false};
+            for (std::size_t i = 0; i != States * Events; ++i)
+                t.transition[i] = npos;
+            for (std::size_t k = 0; k != N; ++k) {
+                std::size_t& slot = t.transition[from[k] * Events + event[k]];
+                if (slot != npos)
+                    t.duplicate = true;
+                slot = k;
+            }
+            return t;
+        }
+
+        template <typename Initial, typename ...Transition>
+        struct traits {
+            using states = typename unique<types<>, Initial,
+                typename transition_traits<Transition>::from...,
+                typename transition_traits<Transition>::to...
+            >::type;
+
+            using events = typename unique<types<>,
+                typename transition_traits<Transition>::event...
+            >::type;
+        };
+
+        template <typename States, typename Events, typename ...Transition>
+        struct indices;
+
+        template <typename ...S, typename ...E, typename ...Transition>
+        struct indices<types<S...>, types<E...>, Transition...> {
+            static constexpr std::size_t state_count = sizeof...(S);
+            static constexpr std::size_t event_count = sizeof...(E);
+            static constexpr std::size_t transition_count = sizeof...(Transition);
+
+            static constexpr detail::array<std::size_t, transition_count> from() {
+                return {{state_machine_detail::index_of<
+                    typename transition_traits<Transition>::from, S...>()...}};
+            }
+
+            static constexpr detail::array<std::size_t, transition_count> to() {
+                return {{state_machine_detail::index_of<
+                    typename transition_traits<Transition>::to, S...>()...}};
+            }
+
+            static constexpr detail::array<std::size_t, transition_count> event() {
+                return {{state_machine_detail::index_of<
+                    typename transition_traits<Transition>::event, E...>()...}};
+            }
+
+            static constexpr table<state_count, event_count> dense() {
+                return state_machine_detail::make_table<state_count, event_count>(
+                    from(), event());
+            }
+        };
+
+        // Calls the action with the event if it accepts it, and without
+        // arguments otherwise.
+        template <typename Action, typename Event>
+        constexpr auto call_action(Action& action, Event const& e, int)
+            -> decltype((void)action(e))
+        { action(e); }
+
+        template <typename Action, typename Event>
+        constexpr void call_action(Action& action, Event const&, long)
+        { action(); }
+
+        // When all the events are `IntegralConstant`s with values of the
+        // same type, a runtime value of that type may be processed.
+        template <typename Events, typename = void>
+        struct runtime_events {
+            static constexpr bool value = false;
+        };
+
+        template <typename ...E>
+        struct runtime_events<types<E...>, typename std::enable_if<
+            detail::fast_and<hana::Constant<E>::value...>::value
+        >::type> {
+            using value_type = typename std::common_type<
+                typename std::decay<decltype(hana::value<E>())>::type...
+            >::type;
+            static constexpr bool value = true;
+
+            // When the values are consecutive, the index of an event is found
+            // with a subtraction instead of a search.
+            static constexpr bool consecutive() {
+                constexpr value_type values[] = {hana::value<E>()...};
+                for (std::size_t i = 1; i != sizeof...(E); ++i)
+                    if (values[i] != values[0] + static_cast<value_type>(i))
+                        return false;
+                return true;
+            }
+
+            static constexpr std::size_t index_of(value_type v) {
+                constexpr value_type values[] = {hana::value<E>()...};
+                if (consecutive()) {
+                    std::size_t i = static_cast<std::size_t>(v - values[0]);
+                    return v < values[0] || i >= sizeof...(E) ? npos : i;
+                }
+                for (std::size_t i = 0; i != sizeof...(E); ++i)
+                    if (values[i] == v)
+                        return i;
+                return npos;
+            }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Finite state machine whose transitions are known at compile-time.
+    //!
+    //! A `state_machine` is created with `make_state_machine(initial,
+    //! transitions)`, where `initial` is the initial state and `transitions`
+    //! is a `hana::tuple` of `experimental::transition`s. States and events
+    //! are `hana::type`s or `IntegralConstant`s, and they are compared by
+    //! type. The transitions are validated at compile-time: there may be at
+    //! most one transition for each state and event.
+    //!
+    //! At compile-time, the transitions are laid out in a dense table
+    //! indexed by the current state and the event. The current state is
+    //! stored at runtime as an index, and `process(e)` finds the transition
+    //! and the next state with two loads from the table, and then calls the
+    //! action through a single indirect call, without allocating or
+    //! searching. The action is called with `e` if it accepts it, and
+    //! without arguments otherwise. `process(e)` returns whether a
+    //! transition was taken; when there is no transition for the current
+    //! state and `e`, the event is ignored.
+    //!
+    //! `e` may be an event of the state machine, i.e. a `hana::type` or an
+    //! `IntegralConstant`, or an object of type `T` for an event
+    //! `hana::type_c<T>`, in which case the event is known at compile-time.
+    //! When all the events are `IntegralConstant`s, `e` may also be a
+    //! runtime value, which is first mapped to an event with a subtraction
+    //! when the values of the events are consecutive, and with a search
+    //! otherwise. The action is then called with the `IntegralConstant`.
+    template <typename Initial, typename Transitions>
+    class state_machine;
+
+    template <typename Initial, typename ...Transition>
+    class state_machine<Initial, hana::tuple<Transition...>> {
+        using Traits = state_machine_detail::traits<Initial, Transition...>;
+        using States = typename Traits::states;
+        using Events = typename Traits::events;
+        using Indices = state_machine_detail::indices<States, Events, Transition...>;
+        using Runtime = state_machine_detail::runtime_events<Events>;
+
+        static constexpr std::size_t state_count = Indices::state_count;
+        static constexpr std::size_t event_count = Indices::event_count;
+
+        static_assert(detail::fast_and<
+            state_machine_detail::is_key<typename state_machine_detail::transition_traits<Transition>::from>::value...,
+            state_machine_detail::is_key<typename state_machine_detail::transition_traits<Transition>::to>::value...,
+            state_machine_detail::is_key<Initial>::value
+        >::value,
+        "hana::experimental::make_state_machine(initial, transitions) requires the states to be hana::types or IntegralConstants");
+
+        static_assert(detail::fast_and<
+            state_machine_detail::is_key<typename state_machine_detail::transition_traits<Transition>::event>::value...
+        >::value,
+        "hana::experimental::make_state_machine(initial, transitions) requires the events to be hana::types or IntegralConstants");
+
+        static_assert(!Indices::dense().duplicate,
+        "hana::experimental::make_state_machine(initial, transitions) requires at most one transition for each state and event");
+
+        hana::tuple<Transition...> transitions_;
+        std::size_t state_;
+
+        // The dense table and the next state of each transition are plain
+        // data, so the next state is found with two loads, independently of
+        // the indirect call to the action.
+        template <typename Call, typename ...Args>
+        bool step(std::size_t e, Call const* actions, Args const& ...args) {
+            static constexpr auto dense = Indices::dense();
+            static constexpr auto to = Indices::to();
+            std::size_t const k = dense.transition[state_ * event_count + e];
+            if (k == state_machine_detail::npos)
+                return false;
+            std::size_t const next = to[k];
+            actions[k](*this, args...);
+            state_ = next;
+            return true;
+        }
+
+        template <std::size_t k, typename Event>
+        static void call(state_machine& m, Event const& e) {
+            auto& action = hana::first(hana::second(hana::at_c<k>(m.transitions_)));
+            state_machine_detail::call_action(action, e, int{});
+        }
+
+        // When the event is known at compile-time, the actions of the
+        // transitions for other events are never called.
+        template <std::size_t k, std::size_t e, typename Event>
+        static void call_if(state_machine& m, Event const& event) {
+            call_if<k>(m, event, std::integral_constant<bool, Indices::event()[k] == e>{});
+        }
+
+        template <std::size_t k, typename Event>
+        static void call_if(state_machine& m, Event const& event, std::true_type)
+        { call<k>(m, event); }
+
+        template <std::size_t k, typename Event>
+        static void call_if(state_machine&, Event const&, std::false_type)
+        { }
+
+        template <typename Event, std::size_t ...k>
+        bool process_static(Event const& event, std::index_sequence<k...>) {
+            constexpr std::size_t e = event_index<Event>();
+            static constexpr void (*actions[])(state_machine&, Event const&) = {
+                &state_machine::template call_if<k, e, Event>...
+            };
+            return this->step(e, actions, event);
+        }
+
+        // When the event is only known at runtime, the action is called with
+        // the event of the transition.
+        template <std::size_t k>
+        static void call_constant(state_machine& m) {
+            using Event = typename decltype(
+                hana::at_c<Indices::event()[k]>(Events{})
+            )::type;
+            call<k>(m, Event{});
+        }
+
+        template <typename Value, std::size_t ...k>
+        bool process_runtime(Value const& v, std::index_sequence<k...>) {
+            static_assert(Runtime::value,
+            "hana::experimental::state_machine::process(e) requires 'e' to be an event of the state machine, or a runtime value of its events when they are all IntegralConstants");
+            static constexpr void (*actions[])(state_machine&) = {
+                &state_machine::template call_constant<k>...
+            };
+            std::size_t const e = Runtime::index_of(v);
+            if (e == state_machine_detail::npos)
+                return false;
+            return this->step(e, actions);
+        }
+
+        template <typename Event>
+        bool process(Event const& e, std::true_type) {
+            return this->process_static(e,
+                std::make_index_sequence<sizeof...(Transition)>{});
+        }
+
+        template <typename Value>
+        bool process(Value const& v, std::false_type) {
+            return this->process_runtime(v,
+                std::make_index_sequence<sizeof...(Transition)>{});
+        }
+
+        // The index of an event given as an object; objects of type `T`
+        // stand for the event `hana::type_c<T>`.
+        template <typename Event>
+        static constexpr std::size_t event_index()
+        { return event_index_in<Event>(Events{}); }
+
+        template <typename Event, typename ...E>
+        static constexpr std::size_t event_index_in(types<E...>) {
+            return state_machine_detail::index_of<Event, E...>() != state_machine_detail::npos
+                ? state_machine_detail::index_of<Event, E...>()
+                : state_machine_detail::index_of<
+                    typename std::decay<decltype(hana::type_c<Event>)>::type, E...>();
+        }
+
+        template <typename State, typename ...S>
+        static constexpr std::size_t state_index_in(types<S...>)
+        { return state_machine_detail::index_of<State, S...>(); }
+
+    public:
+        constexpr explicit state_machine(hana::tuple<Transition...> transitions)
+            : transitions_(static_cast<hana::tuple<Transition...>&&>(transitions))
+            , state_(state_index_in<Initial>(States{}))
+        { }
+
+        //! Processes an event, and returns whether a transition was taken.
+        template <typename Event>
+        bool process(Event const& e) {
+            return this->process(e, std::integral_constant<bool,
+                event_index<Event>() != state_machine_detail::npos
+            >{});
+        }
+
+        //! Returns whether the current state is `state`.
+        template <typename State>
+        constexpr bool is(State const&) const {
+            constexpr std::size_t i = state_index_in<State>(States{});
+            static_assert(i != state_machine_detail::npos,
+            "hana::experimental::state_machine::is(state) requires 'state' to be a state of the state machine");
+            return state_ == i;
+        }
+
+        //! Returns the index of the current state, in the order in which the
+        //! states first appear in `initial` and then in the transitions.
+        constexpr std::size_t state() const
+        { return state_; }
+
+        //! The number of distinct states.
+        static constexpr std::size_t states()
+        { return state_count; }
+
+        //! The number of distinct events.
+        static constexpr std::size_t events()
+        { return event_count; }
+    };
+
+    //! @ingroup group-experimental
+    //! Creates an `experimental::state_machine` from its initial state and a
+    //! `hana::tuple` of transitions.
+    struct make_state_machine_t {
+        template <typename Initial, typename ...Transition>
+        constexpr auto operator()(Initial const&, hana::tuple<Transition...> transitions) const {
+            return state_machine<Initial, hana::tuple<Transition...>>{
+                static_cast<hana::tuple<Transition...>&&>(transitions)
+            };
+        }
+    };
+
+    constexpr make_state_machine_t make_state_machine{};
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STATE_MACHINE_HPP
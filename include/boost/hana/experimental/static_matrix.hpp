@@ -0,0 +1,396 @@
+/*
+@file
+Defines `boost::hana::experimental::static_vector` and
+`boost::hana::experimental::static_matrix`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STATIC_MATRIX_HPP
+#define BOOST_HANA_EXPERIMENTAL_STATIC_MATRIX_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace static_matrix_detail {
+        // Align the storage like a SIMD register when it is large enough to
+        // fill one, so that the compiler can use aligned loads and stores.
+        template <typename T, std::size_t N>
+        struct alignment {
+            static constexpr std::size_t value =
+                sizeof(T) * N >= 32 ? 32 :
+                sizeof(T) * N >= 16 ? 16 : alignof(T);
+        };
+
+        // The element-wise operations are expanded over an index_sequence
+        // instead of looping, so that they are fully unrolled and can be
+        // vectorized by the SLP vectorizer.
+        template <typename T, std::size_t ...i>
+        constexpr void add(T const* x, T const* y, T* out,
+                           std::index_sequence<i...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(out[i] = x[i] + y[i]), 0)...};
+        }
+
+        template <typename T, std::size_t ...i>
+        constexpr void subtract(T const* x, T const* y, T* out,
+                                std::index_sequence<i...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(out[i] = x[i] - y[i]), 0)...};
+        }
+
+        template <typename T, std::size_t ...i>
+        constexpr void scale(T a, T const* x, T* out, std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(out[i] = a * x[i]), 0)...};
+        }
+
+        template <typename T, std::size_t ...i>
+        constexpr T dot(T const* u, T const* v, std::index_sequence<i...>) {
+            T result{};
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(result += u[i] * v[i]), 0)...};
+            return result;
+        }
+
+        template <typename T, std::size_t ...i>
+        constexpr void axpy(T a, T const* x, T* y, std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(y[i] += a * x[i]), 0)...};
+        }
+
+        // Each row of the product is accumulated as a linear combination of
+        // the rows of `b`, so that the innermost operation works on
+        // contiguous elements. The index `ik` goes over the elements of `a`.
+        template <std::size_t C, std::size_t K, typename T, std::size_t ...ik>
+        constexpr void multiply(T const* a, T const* b, T* out,
+                                std::index_sequence<ik...>)
+        {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)static_matrix_detail::axpy(
+                a[ik], b + (ik % C) * K, out + (ik / C) * K,
+                std::make_index_sequence<K>{}
+            ), 0)...};
+        }
+
+        template <typename T>
+        constexpr T abs(T x)
+        { return x < T{0} ? -x : x; }
+
+        template <typename T>
+        constexpr void swap_rows(T* m, std::size_t n, std::size_t i, std::size_t j) {
+            for (std::size_t k = 0; k != n; ++k) {
+                T tmp = m[i * n + k];
+                m[i * n + k] = m[j * n + k];
+                m[j * n + k] = tmp;
+            }
+        }
+
+        // Gaussian elimination with partial pivoting.
+        template <typename T>
+        constexpr T determinant(T* m, std::size_t n, std::false_type) {
+            T det{1};
+            for (std::size_t k = 0; k != n; ++k) {
+                std::size_t pivot = k;
+                for (std::size_t i = k + 1; i != n; ++i)
+                    if (abs(m[i * n + k]) > abs(m[pivot * n + k]))
+                        pivot = i;
+                if (m[pivot * n + k] == T{0})
+                    return T{0};
+                if (pivot != k) {
+                    swap_rows(m, n, pivot, k);
+                    det = -det;
+                }
+                det *= m[k * n + k];
+                for (std::size_t i = k + 1; i != n; ++i) {
+                    T factor = m[i * n + k] / m[k * n + k];
+                    for (std::size_t j = k + 1; j != n; ++j)
+                        m[i * n + j] -= factor * m[k * n + j];
+                }
+            }
+            return det;
+        }
+
+        // The Bareiss algorithm, which only performs exact divisions, so the
+        // determinant of an integral matrix is computed without rounding.
+        template <typename T>
+        constexpr T determinant(T* m, std::size_t n, std::true_type) {
+            T sign{1}, previous{1};
+            for (std::size_t k = 0; k + 1 < n; ++k) {
+                if (m[k * n + k] == T{0}) {
+                    std::size_t i = k + 1;
+                    while (i != n && m[i * n + k] == T{0})
+                        ++i;
+                    if (i == n)
+                        return T{0};
+                    swap_rows(m, n, i, k);
+                    sign = -sign;
+                }
+                for (std::size_t i = k + 1; i != n; ++i)
+                    for (std::size_t j = k + 1; j != n; ++j)
+                        m[i * n + j] = (m[i * n + j] * m[k * n + k]
+                                      - m[i * n + k] * m[k * n + j]) / previous;
+                previous = m[k * n + k];
+            }
+            return n == 0 ? T{1} : sign * m[(n - 1) * n + (n - 1)];
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Fixed-size vector of arithmetic values stored contiguously.
+    //!
+    //! Unlike a `hana::tuple` of numbers, a `static_vector` is guaranteed to
+    //! be stored in a contiguous and suitably aligned array, and its
+    //! operations are unrolled kernels that compilers can vectorize. A
+    //! `static_vector` can be created from a homogeneous `hana::tuple` with
+    //! `to_static_vector`.
+    template <typename T, std::size_t N>
+    struct static_vector {
+        static_assert(std::is_arithmetic<T>{},
+        "hana::experimental::static_vector<T, N> requires 'T' to be an arithmetic type");
+
+        using value_type = T;
+
+        alignas(static_matrix_detail::alignment<T, N>::value)
+        T elems_[N > 0 ? N : 1];
+
+        static constexpr std::size_t size() { return N; }
+
+        constexpr T& operator[](std::size_t i) { return elems_[i]; }
+        constexpr T const& operator[](std::size_t i) const { return elems_[i]; }
+
+        constexpr T* data() { return elems_; }
+        constexpr T const* data() const { return elems_; }
+
+        friend constexpr static_vector operator+(static_vector const& u, static_vector const& v) {
+            static_vector result{};
+            static_matrix_detail::add(u.elems_, v.elems_, result.elems_,
+                                      std::make_index_sequence<N>{});
+            return result;
+        }
+
+        friend constexpr static_vector operator-(static_vector const& u, static_vector const& v) {
+            static_vector result{};
+            static_matrix_detail::subtract(u.elems_, v.elems_, result.elems_,
+                                           std::make_index_sequence<N>{});
+            return result;
+        }
+
+        friend constexpr static_vector operator*(T a, static_vector const& v) {
+            static_vector result{};
+            static_matrix_detail::scale(a, v.elems_, result.elems_,
+                                        std::make_index_sequence<N>{});
+            return result;
+        }
+
+        friend constexpr bool operator==(static_vector const& u, static_vector const& v) {
+            for (std::size_t i = 0; i != N; ++i)
+                if (!(u.elems_[i] == v.elems_[i]))
+                    return false;
+            return true;
+        }
+
+        friend constexpr bool operator!=(static_vector const& u, static_vector const& v)
+        { return !(u == v); }
+    };
+
+    //! @ingroup group-experimental
+    //! Fixed-size matrix of arithmetic values stored contiguously, in
+    //! row-major order.
+    //!
+    //! A `static_matrix` can be created from a `hana::tuple` of rows, which
+    //! are themselves homogeneous `hana::tuple`s, with `to_static_matrix`.
+    //! Matrices support `+`, `-`, multiplication by a scalar, by a vector
+    //! and by another matrix, `transpose` and `determinant`. The
+    //! determinant is computed by elimination in `O(n^3)` operations.
+    template <typename T, std::size_t R, std::size_t C>
+    struct static_matrix {
+        static_assert(std::is_arithmetic<T>{},
+        "hana::experimental::static_matrix<T, R, C> requires 'T' to be an arithmetic type");
+
+        using value_type = T;
+
+        alignas(static_matrix_detail::alignment<T, R * C>::value)
+        T elems_[R * C > 0 ? R * C : 1];
+
+        static constexpr std::size_t rows() { return R; }
+        static constexpr std::size_t columns() { return C; }
+
+        constexpr T& operator()(std::size_t i, std::size_t j)
+        { return elems_[i * C + j]; }
+
+        constexpr T const& operator()(std::size_t i, std::size_t j) const
+        { return elems_[i * C + j]; }
+
+        constexpr T* data() { return elems_; }
+        constexpr T const* data() const { return elems_; }
+
+        friend constexpr static_matrix operator+(static_matrix const& a, static_matrix const& b) {
+            static_matrix result{};
+            static_matrix_detail::add(a.elems_, b.elems_, result.elems_,
+                                      std::make_index_sequence<R * C>{});
+            return result;
+        }
+
+        friend constexpr static_matrix operator-(static_matrix const& a, static_matrix const& b) {
+            static_matrix result{};
+            static_matrix_detail::subtract(a.elems_, b.elems_, result.elems_,
+                                           std::make_index_sequence<R * C>{});
+            return result;
+        }
+
+        friend constexpr static_matrix operator*(T s, static_matrix const& a) {
+            static_matrix result{};
+            static_matrix_detail::scale(s, a.elems_, result.elems_,
+                                        std::make_index_sequence<R * C>{});
+            return result;
+        }
+
+        friend constexpr static_vector<T, R>
+        operator*(static_matrix const& a, static_vector<T, C> const& v) {
+            static_vector<T, R> result{};
+            for (std::size_t i = 0; i != R; ++i)
+                result[i] = static_matrix_detail::dot(a.elems_ + i * C, v.data(),
+                                                      std::make_index_sequence<C>{});
+            return result;
+        }
+
+        template <std::size_t K>
+        friend constexpr static_matrix<T, R, K>
+        operator*(static_matrix const& a, static_matrix<T, C, K> const& b) {
+            static_matrix<T, R, K> result{};
+            static_matrix_detail::multiply<C, K>(a.elems_, b.data(), result.data(),
+                                                 std::make_index_sequence<R * C>{});
+            return result;
+        }
+
+        friend constexpr bool operator==(static_matrix const& a, static_matrix const& b) {
+            for (std::size_t i = 0; i != R * C; ++i)
+                if (!(a.elems_[i] == b.elems_[i]))
+                    return false;
+            return true;
+        }
+
+        friend constexpr bool operator!=(static_matrix const& a, static_matrix const& b)
+        { return !(a == b); }
+    };
+
+    //! Returns the scalar product of two `static_vector`s.
+    template <typename T, std::size_t N>
+    constexpr T dot(static_vector<T, N> const& u, static_vector<T, N> const& v) {
+        return static_matrix_detail::dot(u.data(), v.data(),
+                                         std::make_index_sequence<N>{});
+    }
+
+    //! Returns the transpose of a `static_matrix`.
+    template <typename T, std::size_t R, std::size_t C>
+    constexpr static_matrix<T, C, R> transpose(static_matrix<T, R, C> const& m) {
+        static_matrix<T, C, R> result{};
+        for (std::size_t i = 0; i != R; ++i)
+            for (std::size_t j = 0; j != C; ++j)
+                result(j, i) = m(i, j);
+        return result;
+    }
+
+    namespace static_matrix_detail {
+        template <typename T>
+        constexpr T determinant(static_matrix<T, 1, 1> const& m)
+        { return m(0, 0); }
+
+        template <typename T>
+        constexpr T determinant(static_matrix<T, 2, 2> const& m)
+        { return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0); }
+
+        template <typename T>
+        constexpr T determinant(static_matrix<T, 3, 3> const& m) {
+            return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+                 - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+                 + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+        }
+
+        // Expansion along the first two rows, sharing the 2x2 minors.
+        template <typename T>
+        constexpr T determinant(static_matrix<T, 4, 4> const& m) {
+            T const s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+            T const s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+            T const s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+            T const s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+            T const s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+            T const s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+            T const c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+            T const c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+            T const c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+            T const c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+            T const c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+            T const c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+
+        template <typename T, std::size_t N>
+        constexpr T determinant(static_matrix<T, N, N> const& m) {
+            static_matrix<T, N, N> tmp = m;
+            return static_matrix_detail::determinant(
+                tmp.data(), N, std::integral_constant<bool, std::is_integral<T>::value>{});
+        }
+    }
+
+    //! Returns the determinant of a square `static_matrix`.
+    //!
+    //! Floating point matrices use Gaussian elimination with partial
+    //! pivoting, and integral matrices use the Bareiss algorithm, whose
+    //! divisions are exact. Matrices of size up to 4 use closed forms.
+    template <typename T, std::size_t N>
+    constexpr T determinant(static_matrix<T, N, N> const& m) {
+        return static_matrix_detail::determinant(m);
+    }
+
+    namespace static_matrix_detail {
+        template <typename T, typename Xs, std::size_t ...i>
+        constexpr static_vector<T, sizeof...(i)>
+        to_static_vector(Xs const& xs, std::index_sequence<i...>)
+        { return {{hana::at_c<i>(xs)...}}; }
+
+        template <typename T, std::size_t R, std::size_t C, typename Rows, std::size_t ...i>
+        constexpr static_matrix<T, R, C>
+        to_static_matrix(Rows const& rows, std::index_sequence<i...>)
+        { return {{hana::at_c<i % C>(hana::at_c<i / C>(rows))...}}; }
+    }
+
+    //! Creates a `static_vector` from a `hana::tuple` of numbers of the
+    //! same arithmetic type.
+    template <typename T, typename ...U>
+    constexpr static_vector<T, sizeof...(U) + 1>
+    to_static_vector(hana::tuple<T, U...> const& xs) {
+        static_assert(detail::fast_and<std::is_same<T, U>::value...>::value,
+        "hana::experimental::to_static_vector(xs) requires the elements of 'xs' to have the same type");
+        return static_matrix_detail::to_static_vector<T>(
+            xs, std::make_index_sequence<sizeof...(U) + 1>{});
+    }
+
+    //! Creates a `static_matrix` from a `hana::tuple` of rows, each of which
+    //! is a `hana::tuple` of numbers of the same arithmetic type.
+    template <typename Row, typename ...Rows>
+    constexpr auto to_static_matrix(hana::tuple<Row, Rows...> const& rows) {
+        static_assert(detail::fast_and<std::is_same<Row, Rows>::value...>::value,
+        "hana::experimental::to_static_matrix(rows) requires all the rows to have the same type");
+        using Vector = decltype(experimental::to_static_vector(std::declval<Row const&>()));
+        constexpr std::size_t R = sizeof...(Rows) + 1;
+        constexpr std::size_t C = Vector::size();
+        return static_matrix_detail::to_static_matrix<typename Vector::value_type, R, C>(
+            rows, std::make_index_sequence<R * C>{});
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STATIC_MATRIX_HPP
@@ -0,0 +1,400 @@
+/*!
+@file
+Defines algorithms on compile-time strings.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHMS_HPP
+#define BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHMS_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        template <typename S, typename Tag = typename hana::tag_of<S>::type>
+        struct is_compile_time_string
+            : std::integral_constant<bool,
+                std::is_same<Tag, string_tag>::value ||
+                std::is_same<Tag, string_ref_tag>::value
+            >
+        { };
+
+        constexpr std::size_t string_npos = static_cast<std::size_t>(-1);
+
+        // Returns the index of the first occurrence of [sub, sub + m) in
+        // [s + from, s + n), or `string_npos` if there is none.
+        constexpr std::size_t string_search(char const* s, std::size_t n,
+                                            char const* sub, std::size_t m,
+                                            std::size_t from)
+        {
+            for (std::size_t i = from; i <= n && m <= n - i; ++i) {
+                std::size_t j = 0;
+                while (j != m && s[i + j] == sub[j])
+                    ++j;
+                if (j == m)
+                    return i;
+            }
+            return string_npos;
+        }
+
+        // Number of non-overlapping occurrences of [sub, sub + m) in [s, s + n).
+        constexpr std::size_t string_count(char const* s, std::size_t n,
+                                           char const* sub, std::size_t m)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = detail::string_search(s, n, sub, m, 0);
+                 i != string_npos;
+                 i = detail::string_search(s, n, sub, m, i + m))
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // split
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t Count>
+        struct string_split_bounds {
+            std::size_t begin[Count + 1];
+            std::size_t end[Count + 1];
+        };
+
+        template <std::size_t Count>
+        constexpr string_split_bounds<Count>
+        make_string_split_bounds(char const* s, std::size_t n,
+                                 char const* sub, std::size_t m)
+        {
+            string_split_bounds<Count> bounds{};
+            std::size_t start = 0, k = 0;
+            for (std::size_t i = detail::string_search(s, n, sub, m, 0);
+                 i != string_npos;
+                 i = detail::string_search(s, n, sub, m, i + m))
+            {
+                bounds.begin[k] = start;
+                bounds.end[k] = i;
+                start = i + m;
+                ++k;
+            }
+            bounds.begin[k] = start;
+            bounds.end[k] = n;
+            return bounds;
+        }
+
+        template <typename P, typename D>
+        struct string_split {
+            using source = P;
+            static constexpr std::size_t n = string_ref_length<P>;
+            static constexpr std::size_t m = string_ref_length<D>;
+            static constexpr std::size_t count =
+                detail::string_count(P::get(), n, D::get(), m);
+            static constexpr string_split_bounds<count> bounds =
+                detail::make_string_split_bounds<count>(P::get(), n, D::get(), m);
+        };
+
+        template <typename P, typename D>
+        constexpr string_split_bounds<string_split<P, D>::count>
+        string_split<P, D>::bounds;
+
+        //////////////////////////////////////////////////////////////////////
+        // replace_all
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        constexpr string_ref_buffer<N>
+        string_replace_copy(char const* s, std::size_t n,
+                            char const* from, std::size_t m,
+                            char const* to, std::size_t k)
+        {
+            string_ref_buffer<N> buffer{};
+            std::size_t out = 0, i = 0;
+            for (std::size_t pos = detail::string_search(s, n, from, m, 0);
+                 pos != string_npos;
+                 pos = detail::string_search(s, n, from, m, pos + m))
+            {
+                for (; i != pos; ++i) buffer.data[out++] = s[i];
+                for (std::size_t j = 0; j != k; ++j) buffer.data[out++] = to[j];
+                i = pos + m;
+            }
+            for (; i != n; ++i) buffer.data[out++] = s[i];
+            buffer.data[out] = '\0';
+            return buffer;
+        }
+
+        template <typename P, typename From, typename To>
+        struct string_replace {
+            static constexpr std::size_t n = string_ref_length<P>;
+            static constexpr std::size_t m = string_ref_length<From>;
+            static constexpr std::size_t k = string_ref_length<To>;
+            static constexpr std::size_t count =
+                detail::string_count(P::get(), n, From::get(), m);
+            static constexpr std::size_t size = n - count * m + count * k;
+            static constexpr string_ref_buffer<size> storage =
+                detail::string_replace_copy<size>(P::get(), n, From::get(), m,
+                                                  To::get(), k);
+
+            static constexpr auto const& get() { return storage.data; }
+        };
+
+        template <typename P, typename From, typename To>
+        constexpr string_ref_buffer<string_replace<P, From, To>::size>
+        string_replace<P, From, To>::storage;
+
+        //////////////////////////////////////////////////////////////////////
+        // to_integral
+        //////////////////////////////////////////////////////////////////////
+        // Parses [s, s + n) as a decimal integer of type `T`. Negative values
+        // are accumulated as such, so that the minimum value of a signed type
+        // can be parsed without overflowing.
+        template <typename T>
+        struct string_integral_result {
+            bool valid;
+            T value;
+        };
+
+        template <typename T>
+        constexpr string_integral_result<T>
+        string_to_integral(char const* s, std::size_t n) {
+            constexpr T min = std::numeric_limits<T>::min();
+            constexpr T max = std::numeric_limits<T>::max();
+            string_integral_result<T> result{false, 0};
+            bool negative = false;
+            std::size_t i = 0;
+            if (n != 0 && (s[0] == '-' || s[0] == '+')) {
+                negative = s[0] == '-';
+                if (negative && std::is_unsigned<T>::value)
+                    return result;
+                ++i;
+            }
+            if (i == n)
+                return result;
+            for (; i != n; ++i) {
+                if (s[i] < '0' || s[i] > '9')
+                    return result;
+                T digit = static_cast<T>(s[i] - '0');
+                if (negative) {
+                    if (result.value < (min + digit) / 10)
+                        return result;
+                    result.value = static_cast<T>(result.value * 10 - digit);
+                }
+                else {
+                    if (result.value > (max - digit) / 10)
+                        return result;
+                    result.value = static_cast<T>(result.value * 10 + digit);
+                }
+            }
+            result.valid = true;
+            return result;
+        }
+    }
+
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Returns whether a compile-time string starts with another one.
+        //!
+        //! Both arguments may be any compile-time string, i.e. either a
+        //! `hana::string` or a `hana::string_ref`. The result is a boolean
+        //! `IntegralConstant`, computed by a single `constexpr` comparison.
+        struct starts_with_t {
+            template <typename S, typename Prefix>
+            constexpr auto operator()(S const&, Prefix const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value &&
+                              detail::is_compile_time_string<Prefix>::value,
+                "hana::experimental::starts_with(s, prefix) requires 's' and "
+                "'prefix' to be compile-time strings");
+            #endif
+                using P = typename detail::string_array<S>::type;
+                using Q = typename detail::string_array<Prefix>::type;
+                constexpr std::size_t n = detail::string_ref_length<P>;
+                constexpr std::size_t m = detail::string_ref_length<Q>;
+                return hana::bool_c<m <= n && detail::equal(
+                    P::get(), P::get() + m, Q::get(), Q::get() + m
+                )>;
+            }
+        };
+
+        constexpr starts_with_t starts_with{};
+
+        //! @ingroup group-experimental
+        //! Returns whether a compile-time string ends with another one.
+        //!
+        //! This is the counterpart of `experimental::starts_with`.
+        struct ends_with_t {
+            template <typename S, typename Suffix>
+            constexpr auto operator()(S const&, Suffix const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value &&
+                              detail::is_compile_time_string<Suffix>::value,
+                "hana::experimental::ends_with(s, suffix) requires 's' and "
+                "'suffix' to be compile-time strings");
+            #endif
+                using P = typename detail::string_array<S>::type;
+                using Q = typename detail::string_array<Suffix>::type;
+                constexpr std::size_t n = detail::string_ref_length<P>;
+                constexpr std::size_t m = detail::string_ref_length<Q>;
+                return hana::bool_c<m <= n && detail::equal(
+                    P::get() + (n - m), P::get() + n, Q::get(), Q::get() + m
+                )>;
+            }
+        };
+
+        constexpr ends_with_t ends_with{};
+
+        //! @ingroup group-experimental
+        //! Finds the first occurrence of a substring in a compile-time string.
+        //!
+        //! Returns a `hana::optional` containing an `IntegralConstant` of the
+        //! index of the first occurrence of `sub` in `s`, or `hana::nothing`
+        //! if `sub` does not appear in `s`. Like `hana::index_if`, but the
+        //! search is performed by a single `constexpr` function instead of
+        //! one instantiation per character.
+        struct find_substring_t {
+            template <typename S, typename Sub>
+            constexpr auto operator()(S const&, Sub const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value &&
+                              detail::is_compile_time_string<Sub>::value,
+                "hana::experimental::find_substring(s, sub) requires 's' and "
+                "'sub' to be compile-time strings");
+            #endif
+                using P = typename detail::string_array<S>::type;
+                using Q = typename detail::string_array<Sub>::type;
+                constexpr std::size_t pos = detail::string_search(
+                    P::get(), detail::string_ref_length<P>,
+                    Q::get(), detail::string_ref_length<Q>, 0);
+                return hana::if_(hana::bool_c<pos != detail::string_npos>,
+                    hana::just(hana::size_c<pos>),
+                    hana::nothing
+                );
+            }
+        };
+
+        constexpr find_substring_t find_substring{};
+
+        //! @ingroup group-experimental
+        //! Splits a compile-time string on each occurrence of a delimiter.
+        //!
+        //! Returns a `hana::tuple` of the (possibly empty) pieces of `s`
+        //! between the non-overlapping occurrences of `delimiter`, which
+        //! must be a non-empty compile-time string. The pieces have the same
+        //! representation as `s`; when `s` is a `hana::string_ref`, they
+        //! refer to slices of the original array.
+        struct split_t {
+            template <typename Tag, typename Split, std::size_t ...k>
+            static constexpr auto helper(std::index_sequence<k...>) {
+                return hana::make_tuple(
+                    detail::make_string_from_array<Tag>::template apply<
+                        typename detail::make_string_ref_slice<
+                            typename Split::source,
+                            Split::bounds.begin[k], Split::bounds.end[k]
+                        >::type
+                    >()...
+                );
+            }
+
+            template <typename S, typename Delimiter>
+            constexpr auto operator()(S const&, Delimiter const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value &&
+                              detail::is_compile_time_string<Delimiter>::value,
+                "hana::experimental::split(s, delimiter) requires 's' and "
+                "'delimiter' to be compile-time strings");
+            #endif
+                using D = typename detail::string_array<Delimiter>::type;
+                static_assert(detail::string_ref_length<D> != 0,
+                "hana::experimental::split(s, delimiter) requires 'delimiter' "
+                "to be non-empty");
+
+                using Split = detail::string_split<
+                    typename detail::string_array<S>::type, D
+                >;
+                return helper<typename hana::tag_of<S>::type, Split>(
+                    std::make_index_sequence<Split::count + 1>{}
+                );
+            }
+        };
+
+        constexpr split_t split{};
+
+        //! @ingroup group-experimental
+        //! Replaces every occurrence of a substring in a compile-time string.
+        //!
+        //! Returns a compile-time string with the same representation as `s`,
+        //! in which the non-overlapping occurrences of `from` (which must not
+        //! be empty) are replaced by `to`. The resulting contents are computed
+        //! in a single `constexpr` function and materialized once.
+        struct replace_all_t {
+            template <typename S, typename From, typename To>
+            constexpr auto operator()(S const&, From const&, To const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value &&
+                              detail::is_compile_time_string<From>::value &&
+                              detail::is_compile_time_string<To>::value,
+                "hana::experimental::replace_all(s, from, to) requires 's', "
+                "'from' and 'to' to be compile-time strings");
+            #endif
+                using F = typename detail::string_array<From>::type;
+                static_assert(detail::string_ref_length<F> != 0,
+                "hana::experimental::replace_all(s, from, to) requires 'from' "
+                "to be non-empty");
+
+                return detail::make_string_from_array<
+                    typename hana::tag_of<S>::type
+                >::template apply<detail::string_replace<
+                    typename detail::string_array<S>::type, F,
+                    typename detail::string_array<To>::type
+                >>();
+            }
+        };
+
+        constexpr replace_all_t replace_all{};
+
+        //! @ingroup group-experimental
+        //! Parses a compile-time string as a decimal integer of type `T`.
+        //!
+        //! Returns a `hana::integral_constant<T, v>`, where `v` is the value
+        //! represented by `s`. `s` must be an optional sign followed by at
+        //! least one decimal digit; anything else is a compile-time error.
+        template <typename T>
+        struct to_integral_t {
+            template <typename S>
+            constexpr auto operator()(S const&) const {
+            #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+                static_assert(detail::is_compile_time_string<S>::value,
+                "hana::experimental::to_integral<T>(s) requires 's' to be a "
+                "compile-time string");
+            #endif
+                using P = typename detail::string_array<S>::type;
+                constexpr std::size_t n = detail::string_ref_length<P>;
+                constexpr auto result = detail::string_to_integral<T>(P::get(), n);
+                static_assert(result.valid,
+                "hana::experimental::to_integral<T>(s) requires 's' to be a "
+                "valid integer representable in type T");
+                return hana::integral_c<T, result.value>;
+            }
+        };
+
+        template <typename T>
+        constexpr to_integral_t<T> to_integral{};
+    } // end namespace experimental
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_STRING_ALGORITHMS_HPP
@@ -0,0 +1,331 @@
+/*
+@file
+Defines `boost::hana::experimental::trie`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TRIE_HPP
+#define BOOST_HANA_EXPERIMENTAL_TRIE_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace trie_detail {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // Trie built by inserting the keys one after the other. The children
+        // of each node are a linked list sorted by their label.
+        template <std::size_t Capacity>
+        struct builder {
+            std::size_t child[Capacity];
+            std::size_t sibling[Capacity];
+            unsigned char label[Capacity];
+            std::size_t key[Capacity];
+            std::size_t count;
+            bool duplicate;
+
+            constexpr void insert(char const* s, std::size_t n, std::size_t k) {
+                std::size_t node = 0;
+                for (std::size_t i = 0; i != n; ++i) {
+                    unsigned char c = static_cast<unsigned char>(s[i]);
+                    std::size_t prev = npos, cur = child[node];
+                    while (cur != npos && label[cur] < c) {
+                        prev = cur;
+                        cur = sibling[cur];
+                    }
+                    if (cur == npos || label[cur] != c) {
+                        std::size_t added = count++;
+                        child[added] = npos;
+                        sibling[added] = cur;
+                        label[added] = c;
+                        key[added] = npos;
+                        if (prev == npos)
+                            child[node] = added;
+                        else
+                            sibling[prev] = added;
+                        cur = added;
+                    }
+                    node = cur;
+                }
+                if (key[node] != npos)
+                    duplicate = true;
+                key[node] = k;
+            }
+        };
+
+        template <typename ...P>
+        constexpr std::size_t capacity() {
+            constexpr std::size_t lengths[] = {0, detail::string_ref_length<P>...};
+            std::size_t total = 1;
+            for (std::size_t n : lengths)
+                total += n;
+            return total;
+        }
+
+        template <typename ...P>
+        constexpr builder<trie_detail::capacity<P...>()> build() {
+            constexpr std::size_t Capacity = trie_detail::capacity<P...>();
+            builder<Capacity> b{{}, {}, {}, {}, 1, false};
+            b.child[0] = npos;
+            b.sibling[0] = npos;
+            b.key[0] = npos;
+            char const* keys[] = {"", P::get()...};
+            constexpr std::size_t lengths[] = {0, detail::string_ref_length<P>...};
+            for (std::size_t k = 1; k != sizeof...(P) + 1; ++k)
+                b.insert(keys[k], lengths[k], k - 1);
+            return b;
+        }
+
+        template <std::size_t Nodes>
+        using index_t = typename std::conditional<
+            (Nodes < 0xFFFF), std::uint16_t, std::uint32_t
+        >::type;
+
+        // The trie with its nodes in breadth-first order, so the children of
+        // the node `n` are the nodes `[first[n], first[n + 1])`, sorted by
+        // their label. A node without a key has the key `none`.
+        template <std::size_t Nodes>
+        struct table {
+            using index = index_t<Nodes>;
+            static constexpr index none = static_cast<index>(-1);
+
+            index first[Nodes + 1];
+            unsigned char label[Nodes];
+            index key[Nodes];
+        };
+
+        template <std::size_t Nodes>
+        constexpr typename table<Nodes>::index table<Nodes>::none;
+
+        template <std::size_t Nodes, std::size_t Capacity>
+        constexpr table<Nodes> flatten(builder<Capacity> const& b) {
+            using index = typename table<Nodes>::index;
+            table<Nodes> result{{}, {}, {}};
+            std::size_t order[Nodes] = {};
+            std::size_t tail = 1;
+            for (std::size_t head = 0; head != Nodes; ++head) {
+                result.first[head] = static_cast<index>(tail);
+                for (std::size_t c = b.child[order[head]]; c != npos; c = b.sibling[c])
+                    order[tail++] = c;
+            }
+            result.first[Nodes] = static_cast<index>(Nodes);
+            for (std::size_t n = 0; n != Nodes; ++n) {
+                result.label[n] = b.label[order[n]];
+                result.key[n] = b.key[order[n]] == npos
+                    ? table<Nodes>::none
+                    : static_cast<index>(b.key[order[n]]);
+            }
+            return result;
+        }
+
+        template <typename ...P>
+        struct compiled {
+            static constexpr builder<trie_detail::capacity<P...>()> built =
+                trie_detail::build<P...>();
+
+            static_assert(!built.duplicate,
+            "hana::experimental::make_trie(routes) requires the keys to be distinct");
+
+            static constexpr std::size_t nodes = built.count;
+            static constexpr table<nodes> nodes_table =
+                trie_detail::flatten<nodes>(built);
+        };
+
+        template <typename ...P>
+        constexpr builder<trie_detail::capacity<P...>()> compiled<P...>::built;
+
+        template <typename ...P>
+        constexpr table<compiled<P...>::nodes> compiled<P...>::nodes_table;
+
+        // Handlers of different types are called through a table of
+        // functions, with one function per key.
+        template <typename ...Handler>
+        struct handler_tuple {
+            hana::tuple<Handler...> storage;
+
+            template <std::size_t k, typename ...Args>
+            static void call_at(handler_tuple const& h, Args&& ...args)
+            { hana::at_c<k>(h.storage)(static_cast<Args&&>(args)...); }
+
+            template <std::size_t ...k, typename ...Args>
+            void call(std::size_t key, std::index_sequence<k...>, Args&& ...args) const {
+                static constexpr void (*table[])(handler_tuple const&, Args&&...) = {
+                    &handler_tuple::template call_at<k, Args...>...
+                };
+                table[key](*this, static_cast<Args&&>(args)...);
+            }
+
+            template <typename ...Args>
+            void operator()(std::size_t key, Args&& ...args) const {
+                this->call(key, std::make_index_sequence<sizeof...(Handler)>{},
+                           static_cast<Args&&>(args)...);
+            }
+        };
+
+        // Handlers of the same type, which is common, are stored in an array
+        // instead. This avoids instantiating one function per key.
+        template <typename Handler, std::size_t N>
+        struct handler_array {
+            Handler storage[N];
+
+            template <typename ...Args>
+            void operator()(std::size_t key, Args&& ...args) const
+            { storage[key](static_cast<Args&&>(args)...); }
+        };
+
+        template <typename Handler, typename ...Handlers>
+        struct select_handlers {
+            using type = typename std::conditional<
+                detail::fast_and<std::is_same<Handler, Handlers>::value...>::value,
+                handler_array<Handler, sizeof...(Handlers) + 1>,
+                handler_tuple<Handler, Handlers...>
+            >::type;
+        };
+
+        template <typename Trie>
+        struct make_from_routes {
+            template <typename ...Route>
+            constexpr Trie operator()(Route&& ...route) const
+            { return Trie{hana::second(static_cast<Route&&>(route))...}; }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Result of `experimental::trie::longest_prefix`.
+    //!
+    //! `key` is the index of the longest key that is a prefix of the input,
+    //! and `length` is its length. When no key is a prefix of the input,
+    //! `key` is `std::size_t(-1)` and the result converts to `false`.
+    struct prefix_match {
+        std::size_t key;
+        std::size_t length;
+
+        constexpr explicit operator bool() const
+        { return key != trie_detail::npos; }
+    };
+
+    //! @ingroup group-experimental
+    //! Matches runtime strings against a fixed set of compile-time strings,
+    //! each with an associated handler.
+    //!
+    //! A `trie` is created with `experimental::make_trie(routes)`, where
+    //! `routes` is a `hana::tuple` of `hana::pair`s whose first element is
+    //! a compile-time string and whose second element is a handler. The
+    //! keys must be distinct, which is checked at compile-time.
+    //!
+    //! The trie of the keys is built at compile-time, and its nodes are
+    //! stored in `constexpr` arrays in breadth-first order. Finding the
+    //! longest key which is a prefix of a runtime string is a single walk
+    //! down the trie, which looks at each character of the input once and
+    //! never allocates. Hence, this is much faster than comparing the input
+    //! with each key in turn, and than looking up each prefix of the input
+    //! in a hash table.
+    //!
+    //! `longest_prefix(s)` returns an `experimental::prefix_match`, and
+    //! `dispatch(s, args...)` calls the handler of the longest key which is
+    //! a prefix of `s` with `args...`, and returns whether there was such a
+    //! key. `s` may be a null-terminated string, a pair of iterators or any
+    //! object with `data()` and `size()`. When all the handlers have the
+    //! same type, they are stored in an array; otherwise, they are called
+    //! through a table of functions.
+    template <typename Keys, typename ...Handler>
+    class trie;
+
+    template <typename ...P, typename ...Handler>
+    class trie<types<P...>, Handler...> {
+        using Compiled = trie_detail::compiled<P...>;
+        using Table = trie_detail::table<Compiled::nodes>;
+
+        typename trie_detail::select_handlers<Handler...>::type handlers_;
+
+    public:
+        template <typename ...H>
+        constexpr explicit trie(H&& ...handlers)
+            : handlers_{{static_cast<H&&>(handlers)...}}
+        { }
+
+        //! The number of keys.
+        static constexpr std::size_t size()
+        { return sizeof...(P); }
+
+        template <typename Iterator>
+        constexpr prefix_match longest_prefix(Iterator first, Iterator last) const {
+            auto const& t = Compiled::nodes_table;
+            prefix_match best{trie_detail::npos, 0};
+            if (t.key[0] != Table::none)
+                best.key = t.key[0];
+            std::size_t node = 0;
+            for (std::size_t length = 1; first != last; ++first, ++length) {
+                unsigned char c = static_cast<unsigned char>(*first);
+                std::size_t child = t.first[node];
+                std::size_t const end = t.first[node + 1];
+                while (child != end && t.label[child] < c)
+                    ++child;
+                if (child == end || t.label[child] != c)
+                    break;
+                node = child;
+                if (t.key[node] != Table::none)
+                    best = prefix_match{t.key[node], length};
+            }
+            return best;
+        }
+
+        prefix_match longest_prefix(char const* s) const
+        { return this->longest_prefix(s, s + std::strlen(s)); }
+
+        template <typename String>
+        constexpr auto longest_prefix(String const& s) const
+            -> decltype((void)s.data(), (void)s.size(), prefix_match{})
+        { return this->longest_prefix(s.data(), s.data() + s.size()); }
+
+        template <typename String, typename ...Args>
+        bool dispatch(String const& s, Args&& ...args) const {
+            prefix_match m = this->longest_prefix(s);
+            if (!m)
+                return false;
+            handlers_(m.key, static_cast<Args&&>(args)...);
+            return true;
+        }
+    };
+
+    //! @ingroup group-experimental
+    //! Creates an `experimental::trie` from a `hana::tuple` of pairs of a
+    //! compile-time string and a handler.
+    struct make_trie_t {
+        template <typename ...Key, typename ...Handler>
+        constexpr auto operator()(hana::tuple<hana::pair<Key, Handler>...> routes) const {
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(detail::fast_and<detail::is_compile_time_string<Key>::value...>::value,
+            "hana::experimental::make_trie(routes) requires the keys to be compile-time strings");
+        #endif
+            using Trie = trie<types<typename detail::string_array<Key>::type...>, Handler...>;
+            return hana::unpack(static_cast<hana::tuple<hana::pair<Key, Handler>...>&&>(routes),
+                                trie_detail::make_from_routes<Trie>{});
+        }
+    };
+
+    constexpr make_trie_t make_trie{};
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TRIE_HPP
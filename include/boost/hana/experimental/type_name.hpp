@@ -33,6 +33,11 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
             constexpr std::size_t total_size = sizeof(__PRETTY_FUNCTION__) - 1;
             constexpr std::size_t prefix_size = sizeof("boost::hana::experimental::detail::cstring boost::hana::experimental::detail::type_name_impl2() [T = ") - 1;
             constexpr std::size_t suffix_size = sizeof("]") - 1;
+        #elif defined(__GNUC__)
+            constexpr char const* pretty_function = __PRETTY_FUNCTION__;
+            constexpr std::size_t total_size = sizeof(__PRETTY_FUNCTION__) - 1;
+            constexpr std::size_t prefix_size = sizeof("constexpr boost::hana::experimental::detail::cstring boost::hana::experimental::detail::type_name_impl2() [with T = ") - 1;
+            constexpr std::size_t suffix_size = sizeof("]") - 1;
         #else
             #error "No support for this compiler."
         #endif
@@ -51,8 +56,8 @@ BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
     //! Returns a `hana::string` representing the name of the given type, at
     //! compile-time.
     //!
-    //! This only works on Clang (and apparently MSVC, but Hana does not work
-    //! there as of writing this). Original idea taken from
+    //! This only works on Clang and GCC (and apparently MSVC, but Hana does
+    //! not work there as of writing this). Original idea taken from
     //! https://github.com/Manu343726/ctti.
     template <typename T>
     auto type_name() {
@@ -13,6 +13,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/detail/array.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/compose.hpp>
@@ -96,6 +98,32 @@ namespace experimental {
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // permuted_view
+    //
+    // A view of the `n`-th permutation of a sequence, in the same order as
+    // `hana::permutations`. Only the indices of that permutation are computed,
+    // so this is a sliced_view.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Sequence, std::size_t n, std::size_t ...i>
+        constexpr auto permuted_impl(Sequence& sequence, std::index_sequence<i...>) {
+            constexpr auto indices = hana::detail::nth_permutation<sizeof...(i)>(n);
+            (void)indices; // workaround GCC warning when sizeof...(i) == 0
+            return sliced_view_t<Sequence, indices[i]...>{sequence};
+        }
+    }
+
+    template <typename Sequence, typename N>
+    constexpr auto permuted(Sequence& sequence, N const&) {
+        constexpr std::size_t size = decltype(hana::length(sequence))::value;
+        static_assert(N::value < hana::detail::factorial(size),
+        "hana::experimental::permuted(xs, n) requires 'n' to be less than "
+        "the number of permutations of 'xs'");
+        return detail::permuted_impl<Sequence, N::value>(
+            sequence, std::make_index_sequence<size>{});
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // transformed_view
     //////////////////////////////////////////////////////////////////////////
@@ -157,6 +185,65 @@ namespace experimental {
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // product_view
+    //
+    // A view of the cartesian product of several sequences, in the same order
+    // as `hana::cartesian_product`. Each element is a `hana::tuple` holding
+    // copies of the elements of the combination, and it is only created when
+    // it is accessed.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename ...Sequences>
+        struct product_view_indices {
+            using type = hana::detail::cartesian_product_indices<
+                decltype(hana::length(std::declval<Sequences&>()))::value...
+            >;
+            static constexpr std::size_t length = type::length;
+        };
+
+        template <>
+        struct product_view_indices<> {
+            static constexpr std::size_t length = 0;
+        };
+    }
+
+    template <typename ...Sequences>
+    struct product_view_t {
+        hana::tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
+
+        static constexpr std::size_t length =
+            detail::product_view_indices<Sequences...>::length;
+    };
+
+    struct make_product_view_t {
+        template <typename ...Sequences>
+        constexpr product_view_t<Sequences...> operator()(Sequences& ...s) const {
+            return {hana::tuple<detail::view_storage<Sequences>...>{s...}};
+        }
+    };
+    constexpr make_product_view_t product_view{};
+
+    namespace detail {
+        template <typename ...Sequences>
+        struct is_view<product_view_t<Sequences...>> {
+            static constexpr bool value = true;
+        };
+
+        template <std::size_t n, typename ...Sequences, std::size_t ...k>
+        constexpr auto product_view_element(product_view_t<Sequences...> const& view,
+                                            std::index_sequence<k...>)
+        {
+            constexpr auto indices =
+                product_view_indices<Sequences...>::type::indices_of(n);
+            (void)indices; // workaround GCC warning when sizeof...(k) == 0
+            return hana::make_tuple(
+                hana::at_c<indices[k]>(hana::at_c<k>(view.sequences_))...
+            );
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // single_view
     //////////////////////////////////////////////////////////////////////////
@@ -238,6 +325,26 @@ struct unpack_impl<experimental::view_tag> {
                              std::make_index_sequence<N2>{});
     }
 
+    // product_view
+    template <typename ...Sequences, typename F, std::size_t ...n>
+    static constexpr decltype(auto)
+    unpack_product(experimental::product_view_t<Sequences...> const& view,
+                   F&& f, std::index_sequence<n...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<F&&>(f)(experimental::detail::product_view_element<n>(
+            view, std::index_sequence_for<Sequences...>{}
+        )...);
+    }
+
+    template <typename ...Sequences, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::product_view_t<Sequences...> view, F&& f) {
+        using View = experimental::product_view_t<Sequences...>;
+        return unpack_product(view, static_cast<F&&>(f),
+                              std::make_index_sequence<View::length>{});
+    }
+
     // single_view
     template <typename T, typename F>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, F&& f) {
@@ -290,6 +397,16 @@ struct at_impl<experimental::view_tag> {
         return at_joined_view<Left>(view, n, hana::bool_c<(N::value < Left)>);
     }
 
+    // product_view
+    template <typename ...Sequences, typename N>
+    static constexpr auto
+    apply(experimental::product_view_t<Sequences...> view, N const&) {
+        static_assert(N::value < experimental::product_view_t<Sequences...>::length,
+        "trying to fetch an out-of-bounds element in a hana::product_view");
+        return experimental::detail::product_view_element<N::value>(
+            view, std::index_sequence_for<Sequences...>{});
+    }
+
     // single_view
     template <typename T, typename N>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, N const&) {
@@ -327,6 +444,12 @@ struct length_impl<experimental::view_tag> {
         >;
     }
 
+    // product_view
+    template <typename ...Sequences>
+    static constexpr auto apply(experimental::product_view_t<Sequences...>) {
+        return hana::size_c<experimental::product_view_t<Sequences...>::length>;
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -361,6 +484,12 @@ struct is_empty_impl<experimental::view_tag> {
                           hana::is_empty(view.sequence2_));
     }
 
+    // product_view
+    template <typename ...Sequences>
+    static constexpr auto apply(experimental::product_view_t<Sequences...>) {
+        return hana::bool_c<experimental::product_view_t<Sequences...>::length == 0>;
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -13,13 +13,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
 #include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/fold_left.hpp>
+#include <boost/hana/fwd/for_each.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/transform.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 #include <boost/hana/integral_constant.hpp>
 
 #include <array>
@@ -60,6 +66,12 @@ namespace std {
     //! Iterating over a `std::array` is equivalent to iterating over it with
     //! a normal `for` loop.
     //! @include example/ext/std/array/iterable.cpp
+    //!
+    //! 5. `Functor`\n
+    //! Transforming a `std::array` with a function `f` returns a `std::array`
+    //! of the same size, whose elements have the decayed type of the result
+    //! of `f`.
+    //! @include example/ext/std/array/functor.cpp
     template <typename T, std::size_t N>
     struct array { };
 }
@@ -85,6 +97,103 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct unpack_impl<ext::std::array_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(std::get<i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t N = std::tuple_size<Raw>::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct fold_left_impl<ext::std::array_tag> {
+        template <typename Xs, typename S, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, S&& s, F&& f, std::index_sequence<i...>) {
+            return detail::variadic::foldl1(static_cast<F&&>(f),
+                                            static_cast<S&&>(s),
+                                            std::get<i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            return detail::variadic::foldl1(static_cast<F&&>(f),
+                                            std::get<i>(static_cast<Xs&&>(xs))...);
+        }
+
+        // with state
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t N = std::tuple_size<Raw>::value;
+            return fold_left_helper(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                                    static_cast<F&&>(f),
+                                    std::make_index_sequence<N>{});
+        }
+
+        // without state
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t N = std::tuple_size<Raw>::value;
+            return fold_left_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::array_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr void
+        for_each_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(std::get<i>(static_cast<Xs&&>(xs))), 0)...};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t N = std::tuple_size<Raw>::value;
+            for_each_helper(static_cast<Xs&&>(xs), f,
+                            std::make_index_sequence<N>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::std::array_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F const& f, std::index_sequence<i...>) {
+            using T = typename detail::decay<
+                decltype(f(static_cast<Xs&&>(xs)[0]))
+            >::type;
+            return std::array<T, sizeof...(i)>{{
+                f(std::get<i>(static_cast<Xs&&>(xs)))...
+            }};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F const& f) {
+            using Raw = typename std::remove_reference<Xs>::type;
+            constexpr std::size_t N = std::tuple_size<Raw>::value;
+            return transform_helper(static_cast<Xs&&>(xs), f,
+                                    std::make_index_sequence<N>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
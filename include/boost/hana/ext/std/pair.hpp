@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/first.hpp>
 #include <boost/hana/fwd/second.hpp>
+#include <boost/hana/fwd/unpack.hpp>
 
 #include <utility>
 
@@ -86,6 +87,18 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr U&& apply(std::pair<T, U>&& p)
         {  return static_cast<U&&>(p.second); }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::std::pair_tag> {
+        template <typename P, typename F>
+        static constexpr decltype(auto) apply(P&& p, F&& f) {
+            return static_cast<F&&>(f)(std::get<0>(static_cast<P&&>(p)),
+                                       std::get<1>(static_cast<P&&>(p)));
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_EXT_STD_PAIR_HPP
@@ -0,0 +1,200 @@
+/*!
+@file
+Adapts `std::variant` for use with Hana.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXT_STD_VARIANT_HPP
+#define BOOST_HANA_EXT_STD_VARIANT_HPP
+
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+namespace std {
+    //! @ingroup group-ext-std
+    //! Adaptation of `std::variant` for Hana.
+    //!
+    //! This adapter requires C++17.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! A `std::variant` is seen as a structure containing a single element,
+    //! which is its active alternative. Hence, `unpack(v, f)` calls `f` with
+    //! the active alternative of `v`, and `f` must return the same type for
+    //! all the alternatives. Note that `std::variant` is not `Searchable`,
+    //! because the result of `find_if` would depend on the alternative that
+    //! is active at runtime.
+    //! @include example/ext/std/variant.cpp
+    //!
+    //! 2. Visitation\n
+    //! `hana::visit(f, v...)` is equivalent to `std::visit(f, v...)`. See
+    //! `hana::visit` for details.
+    template <typename ...T>
+    struct variant { };
+}
+#endif
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace ext { namespace std { struct variant_tag; }}
+
+    template <typename ...T>
+    struct tag_of<std::variant<T...>> {
+        using type = ext::std::variant_tag;
+    };
+
+    namespace detail {
+        template <typename F, typename ...V>
+        struct variant_visitor {
+            using Result = decltype(std::declval<F>()(
+                std::get<0>(std::declval<V>())...
+            ));
+
+            using indices = detail::cartesian_product_indices<
+                std::variant_size<std::remove_reference_t<V>>::value...
+            >;
+
+            // The index of the variant is known to be `i` here, but
+            // `std::get` and `std::get_if` check it anyway. We tell the
+            // compiler that `std::get_if` succeeds so it can drop the check.
+            template <std::size_t i, typename W>
+            static constexpr decltype(auto) get(W&& w) {
+                using Alt = decltype(std::get<i>(static_cast<W&&>(w)));
+                auto* p = std::get_if<i>(&w);
+            #if defined(__GNUC__)
+                if (p == nullptr)
+                    __builtin_unreachable();
+            #elif defined(_MSC_VER)
+                __assume(p != nullptr);
+            #endif
+                return static_cast<Alt>(*p);
+            }
+
+            template <std::size_t ...i>
+            static constexpr Result call(F&& f, V&& ...v) {
+                return static_cast<F&&>(f)(
+                    variant_visitor::get<i>(static_cast<V&&>(v))...);
+            }
+
+            template <std::size_t n, std::size_t ...k>
+            static constexpr auto entry(std::index_sequence<k...>) {
+                constexpr auto i = indices::indices_of(n);
+                return &variant_visitor::call<i[k]...>;
+            }
+
+            // With a single variant having few alternatives, we compare the
+            // index with each alternative in turn. Compilers turn this into
+            // a jump table whose cases can be inlined, unlike the calls
+            // through the table of function pointers.
+            template <std::size_t i, std::size_t n>
+            static constexpr Result
+            dispatch(std::size_t index, F&& f, V&& ...v) {
+                if constexpr (i + 1 == n) {
+                    return variant_visitor::call<i>(static_cast<F&&>(f),
+                                                    static_cast<V&&>(v)...);
+                } else {
+                    if (index == i)
+                        return variant_visitor::call<i>(static_cast<F&&>(f),
+                                                        static_cast<V&&>(v)...);
+                    return variant_visitor::dispatch<i + 1, n>(
+                        index, static_cast<F&&>(f), static_cast<V&&>(v)...);
+                }
+            }
+
+            using Entry = Result(*)(F&&, V&&...);
+
+            template <std::size_t ...n>
+            struct make_table {
+                static constexpr Entry table[sizeof...(n)] = {
+                    variant_visitor::entry<n>(
+                        std::make_index_sequence<sizeof...(V)>{})...
+                };
+            };
+
+            template <std::size_t ...n>
+            static constexpr make_table<n...>
+            table_for(std::index_sequence<n...>) { return {}; }
+
+            using Table = decltype(table_for(
+                std::make_index_sequence<indices::length>{}));
+        };
+    }
+
+    //! @ingroup group-ext-std
+    //! Calls a function with the active alternatives of several
+    //! `std::variant`s.
+    //!
+    //! `hana::visit(f, v...)` is equivalent to `std::visit(f, v...)`. The
+    //! functions handling each combination of alternatives are stored in a
+    //! flat table with one entry per element of the cartesian product of
+    //! the alternatives, so that visiting any number of variants costs a
+    //! single indirect call. A single variant with at most 16 alternatives
+    //! is dispatched with a chain of comparisons instead, which compilers
+    //! turn into a jump table. If one of the variants is valueless by
+    //! exception, `std::bad_variant_access` is thrown.
+    //!
+    //! `f` must return the same type for all the combinations of
+    //! alternatives, or at least a type convertible to the type it returns
+    //! for the first alternatives.
+    //!
+    //! @include example/ext/std/variant.cpp
+    struct visit_t {
+        template <typename F, typename ...V>
+        constexpr decltype(auto) operator()(F&& f, V&& ...v) const {
+            static_assert(sizeof...(V) > 0,
+            "hana::visit(f, v...) requires at least one variant");
+
+            using Visitor = detail::variant_visitor<F, V...>;
+            if ((v.valueless_by_exception() || ...))
+                (visit_t::throw_if_valueless(v), ...);
+
+            std::size_t n = 0;
+            ((n = n * std::variant_size<std::remove_reference_t<V>>::value
+                    + v.index()), ...);
+            if constexpr (sizeof...(V) == 1 && Visitor::indices::length <= 16)
+                return Visitor::template dispatch<0, Visitor::indices::length>(
+                    n, static_cast<F&&>(f), static_cast<V&&>(v)...);
+            else
+                return Visitor::Table::table[n](static_cast<F&&>(f),
+                                                static_cast<V&&>(v)...);
+        }
+
+    private:
+        // std::get<0> throws std::bad_variant_access on a valueless variant,
+        // and terminates when exceptions are disabled.
+        template <typename V>
+        static constexpr void throw_if_valueless(V const& v) {
+            if (v.valueless_by_exception())
+                (void)std::get<0>(v);
+        }
+    };
+
+    constexpr visit_t visit{};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::std::variant_tag> {
+        template <typename V, typename F>
+        static constexpr decltype(auto) apply(V&& v, F&& f) {
+            return hana::visit(static_cast<F&&>(f), static_cast<V&&>(v));
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXT_STD_VARIANT_HPP
@@ -0,0 +1,79 @@
+/*!
+@file
+Defines `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/fwd/for_each_product.hpp>
+
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr void for_each_product_t::operator()(Xs const& xs, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using ForEachProduct = BOOST_HANA_DISPATCH_IF(for_each_product_impl<S>,
+            hana::Sequence<S>::value
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(hana::Sequence<S>::value,
+        "hana::for_each_product(xs, f) requires 'xs' to be a Sequence");
+    #endif
+
+        return ForEachProduct::apply(xs, static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct for_each_product_impl<S, when<condition>> : default_ {
+        template <typename F>
+        struct visit {
+            F* f;
+
+            template <typename Indices, std::size_t ...n, typename ...Xs>
+            constexpr void helper(std::index_sequence<n...>, Xs const& ...xs) const {
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(*f)(
+                    Indices::template product_element<S, n>(
+                        std::make_index_sequence<sizeof...(Xs)>{}, xs...)
+                ), 0)...};
+            }
+
+            template <typename ...Xs>
+            constexpr void operator()(Xs const& ...xs) const {
+                using Indices = detail::cartesian_product_indices<
+                    decltype(hana::length(xs))::value...
+                >;
+                this->helper<Indices>(std::make_index_sequence<Indices::length>{}, xs...);
+            }
+
+            constexpr void operator()() const { }
+        };
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs const& xs, F&& f) {
+            // We use a pointer instead of a reference to avoid a Clang ICE.
+            hana::unpack(xs, visit<typename std::remove_reference<F>::type>{&f});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FOR_EACH_PRODUCT_HPP
@@ -0,0 +1,63 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_permutation`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Perform an action on each permutation of a sequence, discarding
+    //! the result each time.
+    //! @ingroup group-Sequence
+    //!
+    //! `for_each_permutation(xs, f)` is equivalent to
+    //! `for_each(permutations(xs), f)`, and `f` is called with the
+    //! permutations in the same order. However, the sequence of all the
+    //! permutations is never created. Each permutation is created right
+    //! before being passed to `f`, and the indices of its elements are
+    //! computed by a `constexpr` function instead of being looked up in
+    //! a table of all the permutations. Since there are `length(xs)!`
+    //! permutations, this can still be expensive to compile, but it is
+    //! much cheaper than `permutations(xs)` for sequences of more than
+    //! a few elements.
+    //!
+    //!
+    //! @param xs
+    //! The sequence whose permutations are iterated over.
+    //!
+    //! @param f
+    //! A function called as `f(p)` for each permutation `p` of `xs`, where
+    //! `p` is a sequence with the same tag as `xs`. The result of `f(p)`,
+    //! whatever it is, is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_permutation.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_permutation = [](auto const& xs, auto&& f) -> void {
+        tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_permutation_impl : for_each_permutation_impl<S, when<true>> { };
+
+    struct for_each_permutation_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs const& xs, F&& f) const;
+    };
+
+    constexpr for_each_permutation_t for_each_permutation{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
@@ -0,0 +1,64 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Perform an action on each element of the cartesian product of a
+    //! sequence of sequences, discarding the result each time.
+    //! @ingroup group-Sequence
+    //!
+    //! `for_each_product(xs, f)` is equivalent to
+    //! `for_each(cartesian_product(xs), f)`, and `f` is called with the
+    //! elements of the product in the same order. However, the sequence
+    //! holding the whole product is never created; each element is created
+    //! right before being passed to `f`. This is much cheaper to compile
+    //! when the product is only used to visit combinations, for example to
+    //! instantiate some code for each combination of a few lists of types.
+    //!
+    //! @note
+    //! All the sequences must have the same tag, and that tag must also match
+    //! that of the top-level sequence.
+    //!
+    //!
+    //! @param xs
+    //! A sequence of sequences whose cartesian product is visited.
+    //!
+    //! @param f
+    //! A function called as `f(p)` for each element `p` of the cartesian
+    //! product, where `p` is a sequence with the same tag as `xs`. The result
+    //! of `f(p)`, whatever it is, is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_product.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_product = [](auto const& xs, auto&& f) -> void {
+        tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_product_impl : for_each_product_impl<S, when<true>> { };
+
+    struct for_each_product_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs const& xs, F&& f) const;
+    };
+
+    constexpr for_each_product_t for_each_product{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
@@ -65,6 +65,16 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! the interface is kept minimal.
     //!
     //!
+    //! @note
+    //! A chain of `transform`s, `ap`s and `chain`s on lazy values is
+    //! represented as a single lazy function call, whose function is the
+    //! composition of all the functions of the chain. Hence, evaluating
+    //! such a chain does not evaluate intermediate lazy expressions; it
+    //! just calls the functions in sequence. However, each evaluation of
+    //! a lazy expression calls all the functions again, unless the
+    //! expression is `memoize`d.
+    //!
+    //!
     //! [1]: http://ldionne.com/2015/03/16/laziness-as-a-comonad
 #ifdef BOOST_HANA_DOXYGEN_INVOKED
     template <typename implementation_defined>
@@ -119,6 +129,53 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! -------
     //! @include example/lazy/make.cpp
     constexpr auto make_lazy = make<lazy_tag>;
+
+    //! Returns a lazy value evaluating a lazy expression at most once.
+    //! @relates hana::lazy
+    //!
+    //! `memoize(expr)` is a lazy value which is equal to `expr`, except it
+    //! evaluates `expr` the first time it is `eval`uated and then returns
+    //! the same result each time it is `eval`uated again. This is useful
+    //! for expensive computations whose result is not always needed, but
+    //! which may be needed several times. The result is shared by all the
+    //! copies of a memoized value, and also by the lazy expressions built
+    //! from it with `transform`, `ap` and `chain`. If evaluating `expr`
+    //! throws an exception, nothing is memoized and `expr` is evaluated
+    //! again on the next evaluation.
+    //!
+    //! `memoize` is not thread-safe; evaluating copies of a memoized value
+    //! concurrently from different threads must be done with
+    //! `memoize_synchronized`, which uses a `std::once_flag` to make sure
+    //! the expression is evaluated exactly once. Contrary to `make_lazy`,
+    //! these functions can't be used in constant expressions.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/lazy/memoize.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto memoize = [](auto&& expr) {
+        return lazy<implementation_defined>{forwarded(expr)};
+    };
+#else
+    template <bool Synchronized>
+    struct memoize_t {
+        template <typename Expr>
+        auto operator()(Expr&& expr) const;
+    };
+
+    constexpr memoize_t<false> memoize{};
+#endif
+
+    //! Thread-safe equivalent to `memoize`.
+    //! @relates hana::lazy
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto memoize_synchronized = [](auto&& expr) {
+        return lazy<implementation_defined>{forwarded(expr)};
+    };
+#else
+    constexpr memoize_t<true> memoize_synchronized{};
+#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FWD_LAZY_HPP
@@ -0,0 +1,139 @@
+/*!
+@file
+Forward declares `boost::hana::string_ref`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_STRING_REF_HPP
+#define BOOST_HANA_FWD_STRING_REF_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @ingroup group-datatypes
+    //! Compile-time string referring to a `constexpr` character array.
+    //!
+    //! `hana::string_ref` is an alternative representation of a compile-time
+    //! string. Instead of encoding each character as a template parameter
+    //! like `hana::string` does, a `hana::string_ref` is keyed by a type `S`
+    //! providing a static `constexpr` function `S::get()`, which returns a
+    //! reference to a null-terminated array of characters (a string literal
+    //! or a static `constexpr` array). Hence, the size of the type does not
+    //! grow with the length of the string, which keeps mangled names short
+    //! and makes comparisons a single `constexpr` loop instead of a pack
+    //! expansion. This makes `hana::string_ref` better suited for long
+    //! strings like format strings or SQL snippets, while `hana::string`
+    //! remains preferable for short strings used as keys.
+    //!
+    //! Note that `hana::string_ref` and `hana::string` are different data
+    //! types. `hana::to<hana::string_tag>` can be used to turn a
+    //! `hana::string_ref` into an equivalent `hana::string`.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! A `hana::string_ref` models exactly the same concepts as `hana::string`,
+    //! with the same semantics. In particular, two `hana::string_ref`s are
+    //! equal if and only if they have the same contents, regardless of the
+    //! type they are keyed by.
+    //!
+    //! 1. `Comparable`, `Orderable` and `Hashable`\n
+    //! Comparison is the usual lexicographical comparison of strings. The
+    //! hash of a `hana::string_ref` is a type computed from its contents,
+    //! so that equal strings have the same hash.
+    //!
+    //! 2. `Monoid`\n
+    //! Strings form a monoid under concatenation, with the neutral element
+    //! being the empty string.
+    //!
+    //! 3. `Foldable`, `Iterable` and `Searchable`\n
+    //! Folding, iterating and searching through a string is equivalent to
+    //! doing so on the sequence of its characters.
+    //!
+    //! Like `hana::string`, `hana::string_ref` is not a `Constant`, for the
+    //! reasons explained in the documentation of `hana::string`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string_ref.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename S>
+    struct string_ref {
+        //! Equivalent to `hana::equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator==(X&& x, Y&& y);
+
+        //! Equivalent to `hana::not_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator!=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::less`
+        template <typename X, typename Y>
+        friend constexpr auto operator<(X&& x, Y&& y);
+
+        //! Equivalent to `hana::greater`
+        template <typename X, typename Y>
+        friend constexpr auto operator>(X&& x, Y&& y);
+
+        //! Equivalent to `hana::less_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator<=(X&& x, Y&& y);
+
+        //! Equivalent to `hana::greater_equal`
+        template <typename X, typename Y>
+        friend constexpr auto operator>=(X&& x, Y&& y);
+
+        //! Performs concatenation; equivalent to `hana::plus`
+        template <typename X, typename Y>
+        friend constexpr auto operator+(X&& x, Y&& y);
+
+        //! Equivalent to `hana::at`
+        template <typename N>
+        constexpr decltype(auto) operator[](N&& n);
+
+        //! Returns a null-delimited C-style string.
+        static constexpr char const* c_str();
+
+        //! Returns the number of characters in the string, as a `constexpr`
+        //! `std::size_t`.
+        static constexpr std::size_t size();
+    };
+#else
+    template <typename S>
+    struct string_ref;
+#endif
+
+    //! Tag representing a compile-time string referring to a character array.
+    //! @relates hana::string_ref
+    struct string_ref_tag { };
+
+    //! Create a `hana::string_ref` keyed by the given type.
+    //! @relates hana::string_ref
+    //!
+    //! `S` must have a static `constexpr` function `get()` returning a
+    //! reference to a null-terminated array of `char`.
+    template <typename S>
+    constexpr string_ref<S> string_ref_c{};
+
+    //! Create a `hana::string_ref` from a string literal.
+    //! @relates hana::string_ref
+    //!
+    //! Like `BOOST_HANA_STRING`, this macro uses a lambda internally, so it
+    //! can't be used in an unevaluated context, or where a constant
+    //! expression is expected before C++17.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto BOOST_HANA_STRING_REF(s) = see documentation;
+    #define BOOST_HANA_STRING_REF(s) see documentation
+#else
+    // defined in <boost/hana/string_ref.hpp>
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_STRING_REF_HPP
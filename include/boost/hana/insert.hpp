@@ -12,13 +12,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/insert.hpp>
 
-#include <boost/hana/append.hpp>
-#include <boost/hana/concat.hpp>
+#include <boost/hana/at.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/drop_front.hpp>
-#include <boost/hana/take_front.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -40,11 +42,25 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S>
     struct insert_impl<S, when<Sequence<S>::value>> {
+        template <typename Xs, typename Element, std::size_t ...before, std::size_t ...after>
+        static constexpr auto
+        insert_helper(Xs&& xs, Element&& e, std::index_sequence<before...>,
+                                            std::index_sequence<after...>)
+        {
+            return hana::make<S>(
+                hana::at_c<before>(static_cast<Xs&&>(xs))...,
+                static_cast<Element&&>(e),
+                hana::at_c<after + sizeof...(before)>(static_cast<Xs&&>(xs))...
+            );
+        }
+
         template <typename Xs, typename N, typename Element>
-        static constexpr auto apply(Xs&& xs, N const& n, Element&& e) {
-            return hana::concat(hana::append(hana::take_front(xs, n),
-                                             static_cast<Element&&>(e)),
-                                hana::drop_front(xs, n));
+        static constexpr auto apply(Xs&& xs, N const&, Element&& e) {
+            constexpr std::size_t len = decltype(hana::length(xs))::value;
+            constexpr std::size_t n = N::value < len ? N::value : len;
+            return insert_helper(static_cast<Xs&&>(xs), static_cast<Element&&>(e),
+                                 std::make_index_sequence<n>{},
+                                 std::make_index_sequence<len - n>{});
         }
     };
 BOOST_HANA_NAMESPACE_END
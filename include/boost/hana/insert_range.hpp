@@ -12,14 +12,17 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/insert_range.hpp>
 
-#include <boost/hana/concat.hpp>
+#include <boost/hana/at.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
-#include <boost/hana/core/to.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/drop_front.hpp>
-#include <boost/hana/take_front.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -46,17 +49,37 @@ BOOST_HANA_NAMESPACE_BEGIN
     }
     //! @endcond
 
+    namespace detail {
+        template <typename S, typename Xs, typename Before, typename After>
+        struct insert_range_helper;
+
+        template <typename S, typename Xs, std::size_t ...before, std::size_t ...after>
+        struct insert_range_helper<S, Xs, std::index_sequence<before...>,
+                                          std::index_sequence<after...>>
+        {
+            Xs& xs;
+
+            template <typename ...Elements>
+            constexpr auto operator()(Elements&& ...e) const {
+                return hana::make<S>(
+                    hana::at_c<before>(static_cast<Xs&&>(xs))...,
+                    static_cast<Elements&&>(e)...,
+                    hana::at_c<after + sizeof...(before)>(static_cast<Xs&&>(xs))...
+                );
+            }
+        };
+    }
+
     template <typename S, bool condition>
     struct insert_range_impl<S, when<condition>> {
         template <typename Xs, typename N, typename Elements>
-        static constexpr auto apply(Xs&& xs, N const& n, Elements&& e) {
-            return hana::concat(
-                    hana::concat(
-                        hana::take_front(xs, n),
-                        hana::to<S>(static_cast<Elements&&>(e))
-                    ),
-                    hana::drop_front(xs, n)
-                );
+        static constexpr auto apply(Xs&& xs, N const&, Elements&& e) {
+            constexpr std::size_t len = decltype(hana::length(xs))::value;
+            constexpr std::size_t n = N::value < len ? N::value : len;
+            using Helper = detail::insert_range_helper<
+                S, Xs, std::make_index_sequence<n>, std::make_index_sequence<len - n>
+            >;
+            return hana::unpack(static_cast<Elements&&>(e), Helper{xs});
         }
     };
 BOOST_HANA_NAMESPACE_END
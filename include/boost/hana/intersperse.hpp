@@ -44,22 +44,23 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <typename S, bool condition>
     struct intersperse_impl<S, when<condition>> : default_ {
+        // `z` is used for several elements of the result, so it is always
+        // copied; moving from it would leave all but one of them moved-from.
         template <std::size_t i, typename Xs, typename Z>
         static constexpr decltype(auto)
-        pick(Xs&&, Z&& z, hana::false_ /* odd index */)
-        { return static_cast<Z&&>(z); }
+        pick(Xs&&, Z const& z, hana::false_ /* odd index */)
+        { return z; }
 
         template <std::size_t i, typename Xs, typename Z>
         static constexpr decltype(auto)
-        pick(Xs&& xs, Z&&, hana::true_ /* even index */)
+        pick(Xs&& xs, Z const&, hana::true_ /* even index */)
         { return hana::at_c<(i + 1) / 2>(static_cast<Xs&&>(xs)); }
 
         template <typename Xs, typename Z, std::size_t ...i>
         static constexpr auto
-        intersperse_helper(Xs&& xs, Z&& z, std::index_sequence<i...>) {
+        intersperse_helper(Xs&& xs, Z const& z, std::index_sequence<i...>) {
             return hana::make<S>(
-                pick<i>(static_cast<Xs&&>(xs), static_cast<Z&&>(z),
-                        hana::bool_c<(i % 2 == 0)>)...
+                pick<i>(static_cast<Xs&&>(xs), z, hana::bool_c<(i % 2 == 0)>)...
             );
         }
 
@@ -67,7 +68,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Xs&& xs, Z&& z) {
             constexpr std::size_t size = decltype(hana::length(xs))::value;
             constexpr std::size_t new_size = size == 0 ? 0 : (size * 2) - 1;
-            return intersperse_helper(static_cast<Xs&&>(xs), static_cast<Z&&>(z),
+            return intersperse_helper(static_cast<Xs&&>(xs), z,
                                       std::make_index_sequence<new_size>{});
         }
     };
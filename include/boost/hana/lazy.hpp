@@ -31,6 +31,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/transform.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -89,6 +92,94 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // memoize
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Expr, bool Synchronized>
+        struct lazy_memo_state;
+
+        template <typename Expr>
+        struct lazy_memo_storage {
+            using result_type = typename detail::decay<
+                decltype(hana::eval(std::declval<Expr&>()))
+            >::type;
+
+            explicit lazy_memo_storage(Expr&& e) : expr(static_cast<Expr&&>(e)) { }
+            explicit lazy_memo_storage(Expr const& e) : expr(e) { }
+            lazy_memo_storage(lazy_memo_storage const&) = delete;
+            lazy_memo_storage& operator=(lazy_memo_storage const&) = delete;
+
+            ~lazy_memo_storage() {
+                if (evaluated)
+                    value().~result_type();
+            }
+
+            // The expression is evaluated as an lvalue, so that it can be
+            // evaluated again if it throws an exception.
+            void evaluate() {
+                ::new (static_cast<void*>(storage)) result_type(hana::eval(expr));
+                evaluated = true;
+            }
+
+            result_type& value()
+            { return *reinterpret_cast<result_type*>(storage); }
+
+            Expr expr;
+            alignas(result_type) unsigned char storage[sizeof(result_type)];
+            bool evaluated = false;
+        };
+
+        template <typename Expr>
+        struct lazy_memo_state<Expr, false> : lazy_memo_storage<Expr> {
+            using lazy_memo_storage<Expr>::lazy_memo_storage;
+
+            typename lazy_memo_storage<Expr>::result_type const& get() {
+                if (!this->evaluated)
+                    this->evaluate();
+                return this->value();
+            }
+        };
+
+        template <typename Expr>
+        struct lazy_memo_state<Expr, true> : lazy_memo_storage<Expr> {
+            using lazy_memo_storage<Expr>::lazy_memo_storage;
+
+            typename lazy_memo_storage<Expr>::result_type const& get() {
+                std::call_once(flag_, [this] { this->evaluate(); });
+                return this->value();
+            }
+
+        private:
+            std::once_flag flag_;
+        };
+    }
+
+    template <typename Expr, bool Synchronized>
+    struct lazy_memo_t : detail::operators::adl<> {
+        explicit lazy_memo_t(detail::lazy_secret, Expr&& expr)
+            : state_{std::make_shared<detail::lazy_memo_state<Expr, Synchronized>>(
+                static_cast<Expr&&>(expr))}
+        { }
+
+        explicit lazy_memo_t(detail::lazy_secret, Expr const& expr)
+            : state_{std::make_shared<detail::lazy_memo_state<Expr, Synchronized>>(expr)}
+        { }
+
+        std::shared_ptr<detail::lazy_memo_state<Expr, Synchronized>> state_;
+        using hana_tag = lazy_tag;
+    };
+
+    //! @cond
+    template <bool Synchronized>
+    template <typename Expr>
+    auto memoize_t<Synchronized>::operator()(Expr&& expr) const {
+        return lazy_memo_t<typename detail::decay<Expr>::type, Synchronized>{
+            detail::lazy_secret{}, static_cast<Expr&&>(expr)
+        };
+    }
+    //! @endcond
+
     //////////////////////////////////////////////////////////////////////////
     // make<lazy_tag>
     //////////////////////////////////////////////////////////////////////////
@@ -150,8 +241,104 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename X>
         static constexpr X apply(lazy_value_t<X>&& expr)
         { return static_cast<X&&>(hana::at_c<0>(expr.storage_)); }
+
+        // lazy_memo_t
+        //
+        // The result is owned by all the copies of the memoized value, so
+        // we return a copy of it when the memoized value is a temporary,
+        // which might be the last copy.
+        template <typename Expr, bool Synchronized>
+        static decltype(auto) apply(lazy_memo_t<Expr, Synchronized> const& expr)
+        { return expr.state_->get(); }
+
+        template <typename Expr, bool Synchronized>
+        static auto apply(lazy_memo_t<Expr, Synchronized>&& expr)
+        { return expr.state_->get(); }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Flattening of lazy expressions
+    //
+    // Transforming a lazy function call composes the function with the
+    // function of the call, instead of creating a lazy call evaluating
+    // the original call. Hence, chains of `transform`, `ap` and `flatten`
+    // produce a single lazy call, which is evaluated without any of the
+    // intermediate lazy expressions.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename F, typename G>
+        struct lazy_compose {
+            F f; G g;
+
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) const&
+            { return f(g(static_cast<X&&>(x)...)); }
+
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) &
+            { return f(g(static_cast<X&&>(x)...)); }
+
+            template <typename ...X>
+            constexpr decltype(auto) operator()(X&& ...x) &&
+            { return static_cast<F&&>(f)(static_cast<G&&>(g)(static_cast<X&&>(x)...)); }
+        };
+
+        template <typename X>
+        struct lazy_apply_to {
+            X x;
+
+            template <typename F>
+            constexpr decltype(auto) operator()(F&& f) const&
+            { return static_cast<F&&>(f)(x); }
+
+            template <typename F>
+            constexpr decltype(auto) operator()(F&& f) &
+            { return static_cast<F&&>(f)(x); }
+
+            template <typename F>
+            constexpr decltype(auto) operator()(F&& f) &&
+            { return static_cast<F&&>(f)(static_cast<X&&>(x)); }
+        };
+
+        // Returns a lazy expression equivalent to `f(eval(expr))`.
+        template <typename Expr>
+        struct lazy_then {
+            template <typename E, typename F>
+            static constexpr auto apply(E&& expr, F&& f) {
+                return hana::make_lazy(hana::compose(static_cast<F&&>(f), hana::eval))(
+                    static_cast<E&&>(expr)
+                );
+            }
+        };
+
+        template <typename X>
+        struct lazy_then<lazy_value_t<X>> {
+            template <typename E, typename F>
+            static constexpr auto apply(E&& expr, F&& f) {
+                return hana::make_lazy(static_cast<F&&>(f))(
+                    hana::at_c<0>(static_cast<E&&>(expr).storage_)
+                );
+            }
+        };
+
+        template <std::size_t ...n, typename G, typename ...Args>
+        struct lazy_then<lazy_apply_t<std::index_sequence<n...>, G, Args...>> {
+            template <typename E, typename F>
+            static constexpr lazy_apply_t<
+                std::index_sequence<n...>,
+                lazy_compose<typename detail::decay<F>::type, G>, Args...
+            > apply(E&& expr, F&& f) {
+                return {detail::lazy_secret{},
+                    lazy_compose<typename detail::decay<F>::type, G>{
+                        static_cast<F&&>(f),
+                        hana::at_c<0>(static_cast<E&&>(expr).storage_)
+                    },
+                    hana::at_c<n+1>(static_cast<E&&>(expr).storage_)...
+                };
+            }
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Functor
     //////////////////////////////////////////////////////////////////////////
@@ -159,9 +346,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct transform_impl<lazy_tag> {
         template <typename Expr, typename F>
         static constexpr auto apply(Expr&& expr, F&& f) {
-            return hana::make_lazy(hana::compose(static_cast<F&&>(f), hana::eval))(
-                static_cast<Expr&&>(expr)
-            );
+            using Then = detail::lazy_then<typename detail::decay<Expr>::type>;
+            return Then::apply(static_cast<Expr&&>(expr), static_cast<F&&>(f));
         }
     };
 
@@ -177,26 +363,81 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace detail {
+        template <typename F, typename X>
+        struct lazy_ap {
+            template <typename Fn, typename Xn>
+            static constexpr auto apply(Fn&& f, Xn&& x) {
+                return hana::make_lazy(hana::on(hana::apply, hana::eval))(
+                    static_cast<Fn&&>(f), static_cast<Xn&&>(x)
+                );
+            }
+        };
+
+        // ap(make_lazy(f), x) is transform(x, f)
+        template <typename G, typename X>
+        struct lazy_ap<lazy_value_t<G>, X> {
+            template <typename Fn, typename Xn>
+            static constexpr auto apply(Fn&& f, Xn&& x) {
+                return transform_impl<lazy_tag>::apply(static_cast<Xn&&>(x),
+                    hana::at_c<0>(static_cast<Fn&&>(f).storage_));
+            }
+        };
+
+        // ap(f, make_lazy(x)) is transform(f, [x](auto&& g) { return g(x); })
+        template <typename F, typename Y>
+        struct lazy_ap<F, lazy_value_t<Y>> {
+            template <typename Fn, typename Xn>
+            static constexpr auto apply(Fn&& f, Xn&& x) {
+                return transform_impl<lazy_tag>::apply(static_cast<Fn&&>(f),
+                    lazy_apply_to<Y>{hana::at_c<0>(static_cast<Xn&&>(x).storage_)});
+            }
+        };
+
+        template <typename G, typename Y>
+        struct lazy_ap<lazy_value_t<G>, lazy_value_t<Y>>
+            : lazy_ap<lazy_value_t<G>, void>
+        { };
+    }
+
     template <>
     struct ap_impl<lazy_tag> {
         template <typename F, typename X>
         static constexpr decltype(auto) apply(F&& f, X&& x) {
-            return hana::make_lazy(hana::on(hana::apply, hana::eval))(
-                static_cast<F&&>(f), static_cast<X&&>(x)
-            );
+            using Ap = detail::lazy_ap<typename detail::decay<F>::type,
+                                       typename detail::decay<X>::type>;
+            return Ap::apply(static_cast<F&&>(f), static_cast<X&&>(x));
         }
     };
 
     //////////////////////////////////////////////////////////////////////////
     // Monad
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Expr>
+        struct lazy_flatten {
+            template <typename E>
+            static constexpr auto apply(E&& expr) {
+                return transform_impl<lazy_tag>::apply(static_cast<E&&>(expr),
+                                                       hana::eval);
+            }
+        };
+
+        // flatten(make_lazy(x)) is x
+        template <typename X>
+        struct lazy_flatten<lazy_value_t<X>> {
+            template <typename E>
+            static constexpr X apply(E&& expr)
+            { return hana::at_c<0>(static_cast<E&&>(expr).storage_); }
+        };
+    }
+
     template <>
     struct flatten_impl<lazy_tag> {
         template <typename Expr>
         static constexpr decltype(auto) apply(Expr&& expr) {
-            return hana::make_lazy(hana::compose(hana::eval, hana::eval))(
-                static_cast<Expr&&>(expr)
-            );
+            using Flatten = detail::lazy_flatten<typename detail::decay<Expr>::type>;
+            return Flatten::apply(static_cast<Expr&&>(expr));
         }
     };
 
@@ -16,6 +16,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/iterable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/iterable_cursor.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/if.hpp>
@@ -62,12 +63,12 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename Ys, typename Pred>
         static constexpr auto
         helper2(Xs const& xs, Ys const& ys, Pred const& pred, hana::false_)
-        { return apply(hana::drop_front(xs), hana::drop_front(ys), pred); }
+        { return compare(hana::drop_front(xs), hana::drop_front(ys), pred); }
 
         template <typename Xs, typename Ys, typename Pred>
         static constexpr auto
         helper2(Xs const& xs, Ys const& ys, Pred const& pred, bool is_greater)
-        { return is_greater ? false : apply(hana::drop_front(xs), hana::drop_front(ys), pred); }
+        { return is_greater ? false : compare(hana::drop_front(xs), hana::drop_front(ys), pred); }
 
 
         template <typename Xs, typename Ys, typename Pred>
@@ -98,12 +99,20 @@ BOOST_HANA_NAMESPACE_BEGIN
 
 
         template <typename Xs, typename Ys, typename Pred>
-        static constexpr auto apply(Xs const& xs, Ys const& ys, Pred const& pred) {
+        static constexpr auto compare(Xs const& xs, Ys const& ys, Pred const& pred) {
             return helper(xs, ys, pred, hana::bool_c<
                 decltype(hana::is_empty(xs))::value ||
                 decltype(hana::is_empty(ys))::value
             >);
         }
+
+        // We iterate over cursors to avoid creating new Iterables each
+        // time we call `drop_front`.
+        template <typename Xs, typename Ys, typename Pred>
+        static constexpr auto apply(Xs const& xs, Ys const& ys, Pred const& pred) {
+            return compare(detail::make_iterable_cursor(xs),
+                           detail::make_iterable_cursor(ys), pred);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
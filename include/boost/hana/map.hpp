@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/map.hpp>
 
 #include <boost/hana/all_of.hpp>
+#include <boost/hana/append.hpp>
 #include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/comparable.hpp>
@@ -87,42 +88,6 @@ BOOST_HANA_NAMESPACE_BEGIN
             >::value;
         };
 
-        template <typename ...>
-        struct storage_is_copy_constructible;
-        template <typename ...T>
-        struct storage_is_copy_constructible<hana::basic_tuple<T...>> {
-            static constexpr bool value = detail::fast_and<
-                BOOST_HANA_TT_IS_CONSTRUCTIBLE(T, T const&)...
-            >::value;
-        };
-
-        template <typename ...>
-        struct storage_is_move_constructible;
-        template <typename ...T>
-        struct storage_is_move_constructible<hana::basic_tuple<T...>> {
-            static constexpr bool value = detail::fast_and<
-                BOOST_HANA_TT_IS_CONSTRUCTIBLE(T, T&&)...
-            >::value;
-        };
-
-        template <typename ...>
-        struct storage_is_copy_assignable;
-        template <typename ...T>
-        struct storage_is_copy_assignable<hana::basic_tuple<T...>> {
-            static constexpr bool value = detail::fast_and<
-                BOOST_HANA_TT_IS_ASSIGNABLE(T, T const&)...
-            >::value;
-        };
-
-        template <typename ...>
-        struct storage_is_move_assignable;
-        template <typename ...T>
-        struct storage_is_move_assignable<hana::basic_tuple<T...>> {
-            static constexpr bool value = detail::fast_and<
-                BOOST_HANA_TT_IS_ASSIGNABLE(T, T&&)...
-            >::value;
-        };
-
         template <typename HashTable, typename Storage>
         struct map_impl final
             : detail::searchable_operators<map_impl<HashTable, Storage>>
@@ -156,39 +121,12 @@ BOOST_HANA_NAMESPACE_BEGIN
                 : storage()
             { }
 
-            template <typename ...Dummy, typename = typename std::enable_if<
-                detail::storage_is_copy_constructible<Storage, Dummy...>::value
-            >::type>
-            constexpr map_impl(map_impl const& other)
-                : storage(other.storage)
-            { }
-
-            template <typename ...Dummy, typename = typename std::enable_if<
-                detail::storage_is_move_constructible<Storage, Dummy...>::value
-            >::type>
-            constexpr map_impl(map_impl&& other)
-                : storage(static_cast<Storage&&>(other.storage))
-            { }
-
-            template <typename ...Dummy, typename = typename std::enable_if<
-                detail::storage_is_move_assignable<Storage, Dummy...>::value
-            >::type>
-            constexpr map_impl& operator=(map_impl&& other) {
-                storage = static_cast<Storage&&>(other.storage);
-                return *this;
-            }
-
-            template <typename ...Dummy, typename = typename std::enable_if<
-                detail::storage_is_copy_assignable<Storage, Dummy...>::value
-            >::type>
-            constexpr map_impl& operator=(map_impl const& other) {
-                storage = other.storage;
-                return *this;
-            }
-
-            // Prevent the compiler from defining the default copy and move
-            // constructors, which interfere with the SFINAE above.
-            ~map_impl() = default;
+            // The copy and move operations are defaulted, so that they are
+            // trivial when those of the storage are.
+            constexpr map_impl(map_impl const&) = default;
+            constexpr map_impl(map_impl&&) = default;
+            map_impl& operator=(map_impl const&) = default;
+            map_impl& operator=(map_impl&&) = default;
         };
         //! @endcond
 
@@ -61,8 +61,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             BOOST_HANA_TT_IS_CONSTRUCTIBLE(Second, Second const&, dummy...)
         >::type>
         constexpr pair(First const& fst, Second const& snd)
-            : detail::ebo<detail::pix<0>, First>(fst)
-            , detail::ebo<detail::pix<1>, Second>(snd)
+            : detail::ebo<detail::pix<0>, First>(detail::ebo_init{}, fst)
+            , detail::ebo<detail::pix<1>, Second>(detail::ebo_init{}, snd)
         { }
 
         template <typename T, typename U, typename = typename std::enable_if<
@@ -70,8 +70,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             BOOST_HANA_TT_IS_CONVERTIBLE(U&&, Second)
         >::type>
         constexpr pair(T&& t, U&& u)
-            : detail::ebo<detail::pix<0>, First>(static_cast<T&&>(t))
-            , detail::ebo<detail::pix<1>, Second>(static_cast<U&&>(u))
+            : detail::ebo<detail::pix<0>, First>(detail::ebo_init{}, static_cast<T&&>(t))
+            , detail::ebo<detail::pix<1>, Second>(detail::ebo_init{}, static_cast<U&&>(u))
         { }
 
 
@@ -83,8 +83,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             BOOST_HANA_TT_IS_CONVERTIBLE(U const&, Second)
         >::type>
         constexpr pair(pair<T, U> const& other)
-            : detail::ebo<detail::pix<0>, First>(hana::first(other))
-            , detail::ebo<detail::pix<1>, Second>(hana::second(other))
+            : detail::ebo<detail::pix<0>, First>(detail::ebo_init{}, hana::first(other))
+            , detail::ebo<detail::pix<1>, Second>(detail::ebo_init{}, hana::second(other))
         { }
 
         template <typename T, typename U, typename = typename std::enable_if<
@@ -94,8 +94,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             BOOST_HANA_TT_IS_CONVERTIBLE(U&&, Second)
         >::type>
         constexpr pair(pair<T, U>&& other)
-            : detail::ebo<detail::pix<0>, First>(hana::first(static_cast<pair<T, U>&&>(other)))
-            , detail::ebo<detail::pix<1>, Second>(hana::second(static_cast<pair<T, U>&&>(other)))
+            : detail::ebo<detail::pix<0>, First>(detail::ebo_init{}, hana::first(static_cast<pair<T, U>&&>(other)))
+            , detail::ebo<detail::pix<1>, Second>(detail::ebo_init{}, hana::second(static_cast<pair<T, U>&&>(other)))
         { }
 
 
@@ -120,9 +120,13 @@ BOOST_HANA_NAMESPACE_BEGIN
             return *this;
         }
 
-        // Prevent the compiler from defining the default copy and move
-        // constructors, which interfere with the SFINAE above.
-        ~pair() = default;
+        // The copy and move operations are defaulted, so that they are
+        // trivial when those of the elements are. They are preferred over
+        // the templates above when both apply.
+        constexpr pair(pair const&) = default;
+        constexpr pair(pair&&) = default;
+        pair& operator=(pair const&) = default;
+        pair& operator=(pair&&) = default;
 
         friend struct first_impl<pair_tag>;
         friend struct second_impl<pair_tag>;
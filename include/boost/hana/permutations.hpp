@@ -42,22 +42,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     }
     //! @endcond
 
-    namespace detail {
-        template <std::size_t N>
-        struct permutation_indices {
-            static constexpr auto value =
-                detail::array<std::size_t, N>{}.iota(0).permutations();
-        };
-    }
-
     template <typename S, bool condition>
     struct permutations_impl<S, when<condition>> : default_ {
         template <std::size_t n, typename Xs, std::size_t ...i>
         static constexpr auto
         nth_permutation(Xs const& xs, std::index_sequence<i...>) {
-            constexpr auto indices = detail::permutation_indices<sizeof...(i)>::value;
+            constexpr auto indices = detail::nth_permutation<sizeof...(i)>(n);
             (void)indices; // workaround GCC warning when sizeof...(i) == 0
-            return hana::make<S>(hana::at_c<indices[n][i]>(xs)...);
+            return hana::make<S>(hana::at_c<indices[i]>(xs)...);
         }
 
         template <std::size_t N, typename Xs, std::size_t ...n>
@@ -75,6 +75,8 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr set() = default;
         constexpr set(set const& other) = default;
         constexpr set(set&& other) = default;
+        set& operator=(set const& other) = default;
+        set& operator=(set&& other) = default;
     };
     //! @endcond
 
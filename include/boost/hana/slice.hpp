@@ -18,10 +18,12 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/length.hpp>
 #include <boost/hana/range.hpp>
 #include <boost/hana/unpack.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -48,14 +50,37 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @endcond
 
     namespace detail {
+        // Returns whether the given indices are all different. Indices that
+        // are out of the bounds of the sequence are ignored here; hana::at
+        // reports them.
+        template <std::size_t Len, std::size_t ...i>
+        constexpr bool distinct_indices() {
+            constexpr std::size_t indices[] = {i..., 0};
+            bool seen[Len + 1] = {};
+            for (std::size_t k = 0; k < sizeof...(i); ++k) {
+                if (indices[k] >= Len)
+                    continue;
+                if (seen[indices[k]])
+                    return false;
+                seen[indices[k]] = true;
+            }
+            return true;
+        }
+
         template <typename Xs>
         struct take_arbitrary {
             Xs& xs;
             using S = typename hana::tag_of<Xs>::type;
 
+            // We can only move from a temporary sequence if no index appears
+            // twice, since we would otherwise end up double-moving.
             template <typename ...N>
             constexpr auto operator()(N const& ...) const {
-                return hana::make<S>(hana::at_c<N::value>(xs)...);
+                constexpr std::size_t len = decltype(hana::length(xs))::value;
+                constexpr bool move = !std::is_reference<Xs>::value &&
+                                      detail::distinct_indices<len, N::value...>();
+                using Ref = typename std::conditional<move, Xs&&, Xs const&>::type;
+                return hana::make<S>(hana::at_c<N::value>(static_cast<Ref>(xs))...);
             }
         };
     }
@@ -74,15 +99,9 @@ BOOST_HANA_NAMESPACE_BEGIN
             );
         }
 
-        //! @todo
-        //! Since we have the right to specify the same index more than once,
-        //! we can't move from the elements of the source sequence even if it
-        //! is a temporary object: we could end up double-moving. Perhaps it
-        //! would be possible to determine the indices from which we can move
-        //! without incurring a too large compile-time penalty?
         template <typename Xs, typename Indices>
-        static constexpr auto apply(Xs const& xs, Indices const& indices) {
-            return hana::unpack(indices, detail::take_arbitrary<Xs const>{xs});
+        static constexpr auto apply(Xs&& xs, Indices const& indices) {
+            return hana::unpack(indices, detail::take_arbitrary<Xs>{xs});
         }
     };
 
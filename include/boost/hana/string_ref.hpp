@@ -0,0 +1,411 @@
+/*!
+@file
+Defines `boost::hana::string_ref`.
+
+@copyright Louis Dionne 2013-2017
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_STRING_REF_HPP
+#define BOOST_HANA_STRING_REF_HPP
+
+#include <boost/hana/fwd/string_ref.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/operators/adl.hpp>
+#include <boost/hana/detail/operators/comparable.hpp>
+#include <boost/hana/detail/operators/iterable.hpp>
+#include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/fwd/at.hpp>
+#include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+#include <boost/hana/fwd/drop_front.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/find.hpp>
+#include <boost/hana/fwd/hash.hpp>
+#include <boost/hana/fwd/is_empty.hpp>
+#include <boost/hana/fwd/length.hpp>
+#include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/plus.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/fwd/zero.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //////////////////////////////////////////////////////////////////////////
+    // Storage of the strings computed by the library
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <std::size_t N>
+        struct string_ref_buffer {
+            char data[N + 1];
+        };
+
+        // Returns a buffer holding the concatenation of [s1, s1 + n1) and
+        // [s2, s2 + n2), followed by a '\0'.
+        template <std::size_t N>
+        constexpr string_ref_buffer<N>
+        string_ref_copy(char const* s1, std::size_t n1,
+                        char const* s2, std::size_t n2)
+        {
+            string_ref_buffer<N> buffer{};
+            std::size_t k = 0;
+            for (std::size_t i = 0; i != n1; ++i) buffer.data[k++] = s1[i];
+            for (std::size_t i = 0; i != n2; ++i) buffer.data[k++] = s2[i];
+            buffer.data[k] = '\0';
+            return buffer;
+        }
+
+        template <typename S>
+        constexpr std::size_t string_ref_length = sizeof(S::get()) - 1;
+
+        struct string_ref_empty {
+            static constexpr decltype(auto) get() { return ""; }
+        };
+
+        // Characters [Begin, End) of the string referred to by `S`.
+        template <typename S, std::size_t Begin, std::size_t End>
+        struct string_ref_slice {
+            static constexpr string_ref_buffer<End - Begin> storage =
+                detail::string_ref_copy<End - Begin>(
+                    S::get() + Begin, End - Begin, "", 0);
+
+            static constexpr auto const& get() { return storage.data; }
+        };
+
+        template <typename S, std::size_t Begin, std::size_t End>
+        constexpr string_ref_buffer<End - Begin>
+        string_ref_slice<S, Begin, End>::storage;
+
+        template <typename S1, typename S2>
+        struct string_ref_concat {
+            static constexpr std::size_t n1 = string_ref_length<S1>;
+            static constexpr std::size_t n2 = string_ref_length<S2>;
+            static constexpr string_ref_buffer<n1 + n2> storage =
+                detail::string_ref_copy<n1 + n2>(S1::get(), n1, S2::get(), n2);
+
+            static constexpr auto const& get() { return storage.data; }
+        };
+
+        template <typename S1, typename S2>
+        constexpr string_ref_buffer<
+            string_ref_concat<S1, S2>::n1 + string_ref_concat<S1, S2>::n2
+        > string_ref_concat<S1, S2>::storage;
+
+        // Slicing a slice refers to the original string instead, so that
+        // repeated `drop_front`s do not create nested types.
+        template <typename S, std::size_t Begin, std::size_t End>
+        struct make_string_ref_slice {
+            using type = string_ref_slice<S, Begin, End>;
+        };
+
+        template <typename S, std::size_t B, std::size_t E,
+                              std::size_t Begin, std::size_t End>
+        struct make_string_ref_slice<string_ref_slice<S, B, E>, Begin, End> {
+            using type = string_ref_slice<S, B + Begin, B + End>;
+        };
+
+        // FNV-1a, used to compute the hash of a `string_ref`.
+        constexpr std::size_t string_ref_fnv1a(char const* s, std::size_t n) {
+            unsigned long long h = 14695981039346656037ull;
+            for (std::size_t i = 0; i != n; ++i) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return static_cast<std::size_t>(h);
+        }
+
+        template <std::size_t Hash>
+        struct string_ref_hash { };
+    }
+
+    namespace detail {
+        // Gives uniform access to the characters of any compile-time string
+        // (`hana::string` or `hana::string_ref`) as a type with a static
+        // `constexpr` function `get()`, like the key of a `hana::string_ref`.
+        template <typename String>
+        struct string_array;
+
+        template <char ...s>
+        struct string_array<hana::string<s...>> {
+            using type = string_array;
+            static constexpr auto const& get() { return string_storage<s...>; }
+        };
+
+        template <typename S>
+        struct string_array<hana::string_ref<S>> {
+            using type = S;
+        };
+
+        // Creates a compile-time string with the given tag, whose contents
+        // are those of the array provided by `P`.
+        template <typename Tag>
+        struct make_string_from_array;
+
+        template <>
+        struct make_string_from_array<string_tag> {
+            template <typename P, std::size_t ...i>
+            static constexpr hana::string<P::get()[i]...>
+            helper(std::index_sequence<i...>) { return {}; }
+
+            template <typename P>
+            static constexpr auto apply() {
+                return helper<P>(std::make_index_sequence<string_ref_length<P>>{});
+            }
+        };
+
+        template <>
+        struct make_string_from_array<string_ref_tag> {
+            template <typename P>
+            static constexpr hana::string_ref<P> apply() { return {}; }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // string_ref<>
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename S>
+    struct string_ref
+        : detail::operators::adl<string_ref<S>>
+        , detail::iterable_operators<string_ref<S>>
+    {
+        static constexpr char const* c_str()
+        { return &S::get()[0]; }
+
+        static constexpr std::size_t size()
+        { return detail::string_ref_length<S>; }
+    };
+    //! @endcond
+
+    template <typename S>
+    struct tag_of<string_ref<S>> {
+        using type = string_ref_tag;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // BOOST_HANA_STRING_REF
+    //////////////////////////////////////////////////////////////////////////
+    namespace string_ref_detail {
+        template <typename S>
+        constexpr string_ref<S> prepare(S) { return {}; }
+    }
+
+#define BOOST_HANA_STRING_REF(s)                                            \
+    (::boost::hana::string_ref_detail::prepare([]{                          \
+        struct tmp {                                                        \
+            static constexpr decltype(auto) get() { return s; }             \
+        };                                                                  \
+        return tmp{};                                                       \
+    }()))                                                                   \
+/**/
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <>
+        struct comparable_operators<string_ref_tag> {
+            static constexpr bool value = true;
+        };
+        template <>
+        struct orderable_operators<string_ref_tag> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // to<char const*>
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<char const*, string_ref_tag> {
+        template <typename S>
+        static constexpr char const* apply(string_ref<S> const&)
+        { return string_ref<S>::c_str(); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // to<string_tag>
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<string_tag, string_ref_tag> {
+        template <typename S, std::size_t ...i>
+        static constexpr auto helper(std::index_sequence<i...>)
+        { return hana::string<S::get()[i]...>{}; }
+
+        template <typename S>
+        static constexpr auto apply(string_ref<S> const&) {
+            return helper<S>(std::make_index_sequence<
+                detail::string_ref_length<S>
+            >{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<string_ref_tag, string_ref_tag> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(string_ref<S1> const&, string_ref<S2> const&) {
+            constexpr std::size_t n1 = detail::string_ref_length<S1>;
+            constexpr std::size_t n2 = detail::string_ref_length<S2>;
+            return hana::bool_c<n1 == n2 && detail::equal(
+                S1::get(), S1::get() + n1,
+                S2::get(), S2::get() + n2
+            )>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<string_ref_tag, string_ref_tag> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(string_ref<S1> const&, string_ref<S2> const&) {
+            return hana::bool_c<detail::lexicographical_compare(
+                S1::get(), S1::get() + detail::string_ref_length<S1>,
+                S2::get(), S2::get() + detail::string_ref_length<S2>
+            )>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct plus_impl<string_ref_tag, string_ref_tag> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(string_ref<S1> const&, string_ref<S2> const&)
+        { return string_ref<detail::string_ref_concat<S1, S2>>{}; }
+    };
+
+    template <>
+    struct zero_impl<string_ref_tag> {
+        static constexpr auto apply()
+        { return string_ref<detail::string_ref_empty>{}; }
+    };
+
+    template <typename S1, typename S2>
+    constexpr auto operator+(string_ref<S1> const&, string_ref<S2> const&)
+    { return string_ref<detail::string_ref_concat<S1, S2>>{}; }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<string_ref_tag> {
+        template <typename S, typename F, std::size_t ...i>
+        static constexpr decltype(auto) helper(F&& f, std::index_sequence<i...>)
+        { return static_cast<F&&>(f)(char_<S::get()[i]>{}...); }
+
+        template <typename S, typename F>
+        static constexpr decltype(auto) apply(string_ref<S> const&, F&& f) {
+            return helper<S>(static_cast<F&&>(f), std::make_index_sequence<
+                detail::string_ref_length<S>
+            >{});
+        }
+    };
+
+    template <>
+    struct length_impl<string_ref_tag> {
+        template <typename S>
+        static constexpr auto apply(string_ref<S> const&)
+        { return hana::size_c<detail::string_ref_length<S>>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<string_ref_tag> {
+        template <typename S, typename N>
+        static constexpr auto apply(string_ref<S> const&, N const&) {
+            constexpr auto n = N::value;
+            return hana::char_c<S::get()[n]>;
+        }
+    };
+
+    template <>
+    struct drop_front_impl<string_ref_tag> {
+        template <typename S, typename N>
+        static constexpr auto apply(string_ref<S> const&, N const&) {
+            constexpr std::size_t len = detail::string_ref_length<S>;
+            constexpr std::size_t n = N::value < len ? N::value : len;
+            return string_ref<
+                typename detail::make_string_ref_slice<S, n, len>::type
+            >{};
+        }
+    };
+
+    template <>
+    struct is_empty_impl<string_ref_tag> {
+        template <typename S>
+        static constexpr auto apply(string_ref<S> const&)
+        { return hana::bool_c<detail::string_ref_length<S> == 0>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct contains_impl<string_ref_tag> {
+        template <typename S, typename C>
+        static constexpr auto
+        helper(string_ref<S> const&, C const&, hana::true_) {
+            constexpr char c = hana::value<C>();
+            constexpr std::size_t len = detail::string_ref_length<S>;
+            return hana::bool_c<
+                detail::find(S::get(), S::get() + len, c) != S::get() + len
+            >;
+        }
+
+        template <typename S, typename C>
+        static constexpr auto helper(S const&, C const&, hana::false_)
+        { return hana::false_c; }
+
+        template <typename S, typename C>
+        static constexpr auto apply(S const& s, C const& c)
+        { return helper(s, c, hana::bool_c<hana::Constant<C>::value>); }
+    };
+
+    template <>
+    struct find_impl<string_ref_tag> {
+        template <typename S, typename Char>
+        static constexpr auto apply(string_ref<S> const& str, Char const& c) {
+            return hana::if_(contains_impl<string_ref_tag>::apply(str, c),
+                hana::just(c),
+                hana::nothing
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash_impl<string_ref_tag> {
+        template <typename S>
+        static constexpr auto apply(string_ref<S> const&) {
+            return hana::type_c<detail::string_ref_hash<
+                detail::string_ref_fnv1a(S::get(), detail::string_ref_length<S>)
+            >>;
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_STRING_REF_HPP
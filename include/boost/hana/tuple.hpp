@@ -52,14 +52,6 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         struct from_index_sequence_t { };
 
-        template <typename Tuple, typename ...Yn>
-        struct is_same_tuple : std::false_type { };
-
-        template <typename Tuple>
-        struct is_same_tuple<typename detail::decay<Tuple>::type, Tuple>
-            : std::true_type
-        { };
-
         template <bool SameTuple, bool SameNumberOfElements, typename Tuple, typename ...Yn>
         struct enable_tuple_variadic_ctor;
 
@@ -146,35 +138,15 @@ BOOST_HANA_NAMESPACE_BEGIN
                     static_cast<tuple<Yn...>&&>(other).storage_)
         { }
 
-        // The three following constructors are required to make sure that
-        // the tuple(Yn&&...) constructor is _not_ preferred over the copy
-        // constructor for unary tuples containing a type that is constructible
-        // from tuple<...>. See test/tuple/cnstr.trap.cpp
-        template <typename ...dummy, typename = typename std::enable_if<
-            detail::fast_and<BOOST_HANA_TT_IS_CONSTRUCTIBLE(Xn, Xn const&, dummy...)...>::value
-        >::type>
-        constexpr tuple(tuple const& other)
-            : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
-                    other.storage_)
-        { }
-
-        template <typename ...dummy, typename = typename std::enable_if<
-            detail::fast_and<BOOST_HANA_TT_IS_CONSTRUCTIBLE(Xn, Xn const&, dummy...)...>::value
-        >::type>
-        constexpr tuple(tuple& other)
-            : tuple(const_cast<tuple const&>(other))
-        { }
-
-        template <typename ...dummy, typename = typename std::enable_if<
-            detail::fast_and<BOOST_HANA_TT_IS_CONSTRUCTIBLE(Xn, Xn&&, dummy...)...>::value
-        >::type>
-        constexpr tuple(tuple&& other)
-            : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
-                    static_cast<tuple&&>(other).storage_)
-        { }
-
+        // The copy and move operations are defaulted, so that they are
+        // trivial when those of the elements are. Since they are not
+        // templates, they are also preferred over the tuple(Yn&&...)
+        // constructor for unary tuples containing a type that is
+        // constructible from tuple<...>. See test/tuple/cnstr.trap.cpp
+        constexpr tuple(tuple const&) = default;
+        constexpr tuple(tuple&&) = default;
+        tuple& operator=(tuple const&) = default;
+        tuple& operator=(tuple&&) = default;
 
         template <typename ...Yn, typename = typename std::enable_if<
             detail::fast_and<BOOST_HANA_TT_IS_ASSIGNABLE(Xn&, Yn const&)...>::value
@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/not_equal.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include "test_case.hpp"
+
+#include <type_traits>
+#include <vector>
+
+
+TestCase test_for_each_permutation{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    // Make sure the permutations are visited in lexicographical order,
+    // which is the order of hana::permutations.
+    {
+        using Permutations = std::vector<std::vector<int>>;
+        auto visit = [](auto xs) {
+            Permutations seen;
+            hana::for_each_permutation(xs, [&](auto const& p) {
+                static_assert(std::is_same<
+                    typename hana::tag_of<decltype(p)>::type, TUPLE_TAG
+                >{}, "");
+                seen.push_back(hana::unpack(p, [](auto ...x) {
+                    return std::vector<int>{x...};
+                }));
+            });
+            return seen;
+        };
+
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE()) == Permutations{{}});
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(0)) == Permutations{{0}});
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(0, 1)) == (Permutations{
+            {0, 1}, {1, 0}
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(0, 1, 2)) == (Permutations{
+            {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(0, 1, 2, 3)) == (Permutations{
+            {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 1, 3}, {0, 2, 3, 1},
+            {0, 3, 1, 2}, {0, 3, 2, 1}, {1, 0, 2, 3}, {1, 0, 3, 2},
+            {1, 2, 0, 3}, {1, 2, 3, 0}, {1, 3, 0, 2}, {1, 3, 2, 0},
+            {2, 0, 1, 3}, {2, 0, 3, 1}, {2, 1, 0, 3}, {2, 1, 3, 0},
+            {2, 3, 0, 1}, {2, 3, 1, 0}, {3, 0, 1, 2}, {3, 0, 2, 1},
+            {3, 1, 0, 2}, {3, 1, 2, 0}, {3, 2, 0, 1}, {3, 2, 1, 0}
+        }));
+    }
+
+    // Make sure it works with heterogeneous sequences.
+    {
+        int calls = 0;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}), [&](auto const& p) {
+            BOOST_HANA_CONSTANT_CHECK(hana::unpack(p, [](auto x, auto y, auto z) {
+                return hana::not_equal(x, y) && hana::not_equal(y, z) && hana::not_equal(x, z);
+            }));
+            ++calls;
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 6);
+    }
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
@@ -0,0 +1,78 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include "test_case.hpp"
+
+#include <type_traits>
+#include <vector>
+
+
+TestCase test_for_each_product{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    // Make sure the combinations are visited in the same order as the
+    // elements of hana::cartesian_product.
+    {
+        using Combinations = std::vector<std::vector<int>>;
+        auto visit = [](auto xs) {
+            Combinations seen;
+            hana::for_each_product(xs, [&](auto const& p) {
+                static_assert(std::is_same<
+                    typename hana::tag_of<decltype(p)>::type, TUPLE_TAG
+                >{}, "");
+                seen.push_back(hana::unpack(p, [](auto ...x) {
+                    return std::vector<int>{x...};
+                }));
+            });
+            return seen;
+        };
+
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE()) == Combinations{});
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(MAKE_TUPLE())) == Combinations{});
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(
+            MAKE_TUPLE(0, 1), MAKE_TUPLE()
+        )) == Combinations{});
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(
+            MAKE_TUPLE(0, 1, 2)
+        )) == (Combinations{{0}, {1}, {2}}));
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(
+            MAKE_TUPLE(0, 1), MAKE_TUPLE(2, 3, 4)
+        )) == (Combinations{
+            {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}
+        }));
+        BOOST_HANA_RUNTIME_CHECK(visit(MAKE_TUPLE(
+            MAKE_TUPLE(0, 1), MAKE_TUPLE(2), MAKE_TUPLE(3, 4)
+        )) == (Combinations{
+            {0, 2, 3}, {0, 2, 4}, {1, 2, 3}, {1, 2, 4}
+        }));
+    }
+
+    // Make sure it works with heterogeneous sequences.
+    {
+        std::vector<int> seen;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}),
+            MAKE_TUPLE(ct_eq<2>{})
+        ), [&](auto const& p) {
+            hana::unpack(p, [&](auto x, auto y) {
+                BOOST_HANA_CONSTANT_CHECK(hana::equal(y, ct_eq<2>{}));
+                seen.push_back(hana::equal(x, ct_eq<0>{}) ? 0 : 1);
+            });
+        });
+        BOOST_HANA_RUNTIME_CHECK(seen == (std::vector<int>{0, 1}));
+    }
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
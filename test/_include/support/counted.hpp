@@ -0,0 +1,50 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef TEST_SUPPORT_COUNTED_HPP
+#define TEST_SUPPORT_COUNTED_HPP
+
+#include <string>
+#include <utility>
+
+
+// A std::string that counts the number of times it is constructed, copied,
+// moved and destroyed. The counts are shared by all Counted objects.
+struct Counted {
+    struct Counts {
+        int constructions = 0;
+        int copies = 0;
+        int moves = 0;
+        int destructions = 0;
+
+        // The number of Counted objects that are currently alive.
+        int alive() const { return constructions + copies + moves - destructions; }
+    };
+
+    static Counts& counts() {
+        static Counts c;
+        return c;
+    }
+
+    std::string value;
+
+    explicit Counted(std::string v) : value(std::move(v))
+    { ++counts().constructions; }
+
+    Counted(Counted const& other) : value(other.value)
+    { ++counts().copies; }
+
+    Counted(Counted&& other) : value(std::move(other.value))
+    { ++counts().moves; }
+
+    Counted& operator=(Counted const& other)
+    { value = other.value; ++counts().copies; return *this; }
+
+    Counted& operator=(Counted&& other)
+    { value = std::move(other.value); ++counts().moves; return *this; }
+
+    ~Counted() { ++counts().destructions; }
+};
+
+#endif // !TEST_SUPPORT_COUNTED_HPP
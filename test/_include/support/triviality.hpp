@@ -0,0 +1,60 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef TEST_SUPPORT_TRIVIALITY_HPP
+#define TEST_SUPPORT_TRIVIALITY_HPP
+
+#include <boost/hana/detail/fast_and.hpp>
+
+#include <string>
+#include <type_traits>
+
+
+// Element types whose special members are trivial, except for one of them.
+struct Trivial { int i; };
+struct TrivialEmpty { };
+struct NonTrivialCopy {
+    NonTrivialCopy() = default;
+    NonTrivialCopy(NonTrivialCopy const&) { }
+    NonTrivialCopy(NonTrivialCopy&&) = default;
+    NonTrivialCopy& operator=(NonTrivialCopy const&) = default;
+    NonTrivialCopy& operator=(NonTrivialCopy&&) = default;
+};
+struct NonTrivialMove {
+    NonTrivialMove() = default;
+    NonTrivialMove(NonTrivialMove const&) = default;
+    NonTrivialMove(NonTrivialMove&&) { }
+    NonTrivialMove& operator=(NonTrivialMove const&) = default;
+    NonTrivialMove& operator=(NonTrivialMove&&) = default;
+};
+struct NonTrivialAssign {
+    NonTrivialAssign& operator=(NonTrivialAssign const&) { return *this; }
+};
+struct NonTrivialDestructor {
+    ~NonTrivialDestructor() { }
+};
+
+// Checks that the copy, move, assignment and destruction of `Container`
+// are trivial if and only if they are trivial for all the `T`s, like they
+// would be for a struct with members of types `T...`.
+template <typename Container, typename ...T>
+struct check_triviality {
+    template <template <typename> class Trait>
+    using all = boost::hana::detail::fast_and<Trait<T>::value...>;
+
+    static_assert(std::is_trivially_copy_constructible<Container>::value ==
+                  all<std::is_trivially_copy_constructible>::value, "");
+    static_assert(std::is_trivially_move_constructible<Container>::value ==
+                  all<std::is_trivially_move_constructible>::value, "");
+    static_assert(std::is_trivially_copy_assignable<Container>::value ==
+                  all<std::is_trivially_copy_assignable>::value, "");
+    static_assert(std::is_trivially_move_assignable<Container>::value ==
+                  all<std::is_trivially_move_assignable>::value, "");
+    static_assert(std::is_trivially_destructible<Container>::value ==
+                  all<std::is_trivially_destructible>::value, "");
+    static_assert(std::is_trivially_copyable<Container>::value ==
+                  all<std::is_trivially_copyable>::value, "");
+};
+
+#endif // !TEST_SUPPORT_TRIVIALITY_HPP
@@ -25,6 +25,11 @@ static_assert(sizeof(inherit<>) == sizeof(inherit<ebo<idx<0>, empty<0>>>), "");
 static_assert(sizeof(inherit<>) == sizeof(inherit<ebo<idx<0>, empty<0>>, ebo<idx<1>, empty<1>>>), "");
 static_assert(sizeof(inherit<>) == sizeof(inherit<ebo<idx<0>, empty<0>>, ebo<idx<1>, empty<1>>, ebo<idx<2>, empty<2>>>), "");
 
+// The copy and move operations are those of the stored object
+static_assert(std::is_trivially_copyable<ebo<idx<0>, int>>{}, "");
+static_assert(std::is_trivially_copyable<ebo<idx<0>, empty<0>>>{}, "");
+static_assert(!std::is_trivially_copyable<ebo<idx<0>, std::string>>{}, "");
+
 
 int main() {
     // Test default-construction
@@ -35,7 +40,7 @@ int main() {
 
     // Test construction of a non-empty object
     {
-        ebo<idx<0>, std::string> e{"foobar"};
+        ebo<idx<0>, std::string> e{hana::detail::ebo_init{}, "foobar"};
         BOOST_HANA_RUNTIME_CHECK(hana::detail::ebo_get<idx<0>>(e) == "foobar");
     }
 
@@ -50,12 +55,12 @@ int main() {
             nodefault() = delete;
             explicit nodefault(char const*) { }
         };
-        ebo<idx<0>, nodefault> e{"foobar"};
+        ebo<idx<0>, nodefault> e{hana::detail::ebo_init{}, "foobar"};
     }
 
     // Get lvalue, const lvalue and rvalue with a non-empty type
     {
-        ebo<idx<0>, std::string> e{"foobar"};
+        ebo<idx<0>, std::string> e{hana::detail::ebo_init{}, "foobar"};
         std::string& s = hana::detail::ebo_get<idx<0>>(e);
         BOOST_HANA_RUNTIME_CHECK(s == "foobar");
         s = "foobaz";
@@ -63,13 +68,13 @@ int main() {
     }
 
     {
-        ebo<idx<0>, std::string> const e{"foobar"};
+        ebo<idx<0>, std::string> const e{hana::detail::ebo_init{}, "foobar"};
         std::string const& s = hana::detail::ebo_get<idx<0>>(e);
         BOOST_HANA_RUNTIME_CHECK(s == "foobar");
     }
 
     {
-        ebo<idx<0>, std::string> e{"foobar"};
+        ebo<idx<0>, std::string> e{hana::detail::ebo_init{}, "foobar"};
         std::string&& s = hana::detail::ebo_get<idx<0>>(std::move(e));
         BOOST_HANA_RUNTIME_CHECK(s == "foobar");
     }
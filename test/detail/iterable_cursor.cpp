@@ -0,0 +1,113 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/iterable_cursor.hpp>
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/drop_while.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/lexicographical_compare.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+// An Iterable which is not a Sequence, and which counts the number of times
+// `drop_front` is actually called.
+int drop_fronts = 0;
+
+struct counted_tag;
+
+template <typename Storage>
+struct counted {
+    Storage storage;
+    using hana_tag = counted_tag;
+};
+
+template <typename Storage>
+constexpr counted<Storage> make_counted(Storage s) { return {s}; }
+
+namespace boost { namespace hana {
+    template <>
+    struct at_impl<counted_tag> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const& n)
+        { return hana::at(static_cast<Xs&&>(xs).storage, n); }
+    };
+
+    template <>
+    struct drop_front_impl<counted_tag> {
+        template <typename Xs, typename N>
+        static auto apply(Xs&& xs, N const& n) {
+            ++drop_fronts;
+            return make_counted(hana::drop_front(static_cast<Xs&&>(xs).storage, n));
+        }
+    };
+
+    template <>
+    struct is_empty_impl<counted_tag> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return hana::is_empty(xs.storage); }
+    };
+}}
+
+int main() {
+    // cursors are Iterables referring to the original
+    {
+        auto xs = hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto c0 = hana::detail::make_iterable_cursor(xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_c<0>(c0), ct_eq<0>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_c<2>(c0), ct_eq<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(c0)));
+
+        auto c2 = hana::drop_front(c0, hana::size_c<2>);
+        static_assert(decltype(c2)::offset == 2, "");
+        BOOST_HANA_RUNTIME_CHECK(c2.xs == &xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_c<0>(c2), ct_eq<2>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(c2)));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(hana::drop_front(c2)));
+
+        auto empty = hana::make_tuple();
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(hana::detail::make_iterable_cursor(empty)));
+
+        // elements are accessed by reference
+        auto ys = hana::make_tuple(1, 2);
+        hana::at_c<0>(hana::drop_front(hana::detail::make_iterable_cursor(ys))) = 20;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 20);
+    }
+
+    // generic algorithms on non-Sequence Iterables don't call drop_front
+    // at each step
+    {
+        auto xs = make_counted(hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}));
+
+        drop_fronts = 0;
+        BOOST_HANA_CONSTANT_CHECK(hana::any_of(xs, hana::equal.to(ct_eq<3>{})));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::any_of(xs, hana::equal.to(ct_eq<9>{}))));
+        BOOST_HANA_RUNTIME_CHECK(drop_fronts == 0);
+
+        drop_fronts = 0;
+        auto rest = hana::drop_while(xs, [](auto x) {
+            return hana::not_(hana::equal(x, ct_eq<2>{}));
+        });
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(rest.storage, hana::make_tuple(ct_eq<2>{}, ct_eq<3>{})));
+        BOOST_HANA_RUNTIME_CHECK(drop_fronts == 1);
+
+        drop_fronts = 0;
+        auto ys = make_counted(hana::make_tuple(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{}));
+        BOOST_HANA_CONSTANT_CHECK(hana::lexicographical_compare(xs, ys));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::lexicographical_compare(ys, xs)));
+        BOOST_HANA_RUNTIME_CHECK(drop_fronts == 0);
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/key_equal.hpp>
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::detail::key_equal;
+
+
+struct T; struct U;
+
+// hana::type
+static_assert(key_equal<hana::type<T>, hana::type<T>>::value, "");
+static_assert(key_equal<hana::type<T>&, hana::type<T> const&>::value, "");
+static_assert(key_equal<hana::type<T>, hana::basic_type<T>>::value, "");
+static_assert(!key_equal<hana::type<T>, hana::type<U>>::value, "");
+static_assert(!key_equal<hana::type<T>, hana::basic_type<U>>::value, "");
+
+// integral_constant
+static_assert(key_equal<hana::int_<0>, hana::int_<0>>::value, "");
+static_assert(key_equal<hana::int_<0>&&, hana::int_<0> const&>::value, "");
+static_assert(!key_equal<hana::int_<0>, hana::int_<1>>::value, "");
+static_assert(key_equal<hana::int_<0>, hana::long_<0>>::value, "");
+static_assert(!key_equal<hana::int_<0>, hana::long_<1>>::value, "");
+static_assert(key_equal<std::integral_constant<int, 0>, std::integral_constant<int, 0>>::value, "");
+static_assert(!key_equal<std::integral_constant<int, 0>, std::integral_constant<int, 1>>::value, "");
+static_assert(key_equal<hana::int_<0>, std::integral_constant<long, 0>>::value, "");
+
+// hana::string
+static_assert(key_equal<hana::string<'a', 'b'>, hana::string<'a', 'b'>>::value, "");
+static_assert(!key_equal<hana::string<'a', 'b'>, hana::string<'a'>>::value, "");
+static_assert(!key_equal<hana::string<>, hana::string<'a'>>::value, "");
+
+// Keys of different kinds
+static_assert(!key_equal<hana::type<T>, hana::int_<0>>::value, "");
+static_assert(!key_equal<hana::int_<0>, hana::string<'0'>>::value, "");
+
+// Other keys are compared with hana::equal
+static_assert(key_equal<
+    hana::tuple<hana::int_<0>, hana::type<T>>,
+    hana::tuple<hana::long_<0>, hana::basic_type<T>>
+>::value, "");
+static_assert(!key_equal<
+    hana::tuple<hana::int_<0>>,
+    hana::tuple<hana::int_<1>>
+>::value, "");
+
+int main() { }
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/array.hpp>
+
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+// Make sure nth_permutation agrees with the table of all the permutations.
+template <std::size_t N>
+constexpr bool agrees_with_permutations() {
+    auto all = hana::detail::array<std::size_t, N>{}.iota(0).permutations();
+    for (std::size_t k = 0; k != all.size(); ++k) {
+        if (!(hana::detail::nth_permutation<N>(k) == all[k]))
+            return false;
+    }
+    return true;
+}
+
+static_assert(agrees_with_permutations<0>(), "");
+static_assert(agrees_with_permutations<1>(), "");
+static_assert(agrees_with_permutations<2>(), "");
+static_assert(agrees_with_permutations<3>(), "");
+static_assert(agrees_with_permutations<4>(), "");
+static_assert(agrees_with_permutations<5>(), "");
+static_assert(agrees_with_permutations<6>(), "");
+
+// It also works when the table would be much too large.
+constexpr auto last = hana::detail::nth_permutation<12>(479001599);
+static_assert(last[0] == 11 && last[5] == 6 && last[11] == 0, "");
+
+constexpr auto some = hana::detail::nth_permutation<10>(1000000);
+static_assert(some[0] == 2 && some[1] == 7 && some[2] == 8 && some[3] == 3, "");
+
+int main() { }
@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/csv.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Trade {
+    BOOST_HANA_DEFINE_STRUCT(Trade,
+        (std::string, symbol),
+        (float, price),
+        (unsigned short, quantity)
+    );
+};
+
+int main() {
+    hana::experimental::csv_columns<Trade> columns =
+        hana::experimental::read_csv_columns<Trade>(
+            "quantity,symbol,price\n"
+            "100,ABC,10.5\n"
+            "20,\"D,E\",0.25\n"
+            "3,F,7\n"
+        );
+
+    auto const& symbol = columns[BOOST_HANA_STRING("symbol")];
+    auto const& price = columns[BOOST_HANA_STRING("price")];
+    auto const& quantity = columns[BOOST_HANA_STRING("quantity")];
+    static_assert(std::is_same<decltype(symbol), std::vector<std::string> const&>{}, "");
+    static_assert(std::is_same<decltype(price), std::vector<float> const&>{}, "");
+    static_assert(std::is_same<decltype(quantity), std::vector<unsigned short> const&>{}, "");
+
+    BOOST_HANA_RUNTIME_CHECK((symbol == std::vector<std::string>{"ABC", "D,E", "F"}));
+    BOOST_HANA_RUNTIME_CHECK((price == std::vector<float>{10.5f, 0.25f, 7.f}));
+    BOOST_HANA_RUNTIME_CHECK((quantity == std::vector<unsigned short>{100, 20, 3}));
+
+    // no records
+    {
+        auto empty = hana::experimental::read_csv_columns<Trade>(
+            std::string{"symbol,price,quantity"});
+        BOOST_HANA_RUNTIME_CHECK(empty[BOOST_HANA_STRING("symbol")].empty());
+        BOOST_HANA_RUNTIME_CHECK(empty[BOOST_HANA_STRING("price")].empty());
+        BOOST_HANA_RUNTIME_CHECK(empty[BOOST_HANA_STRING("quantity")].empty());
+    }
+}
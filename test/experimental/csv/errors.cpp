@@ -0,0 +1,66 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/csv.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Item {
+    BOOST_HANA_DEFINE_STRUCT(Item,
+        (std::string, name),
+        (int, count)
+    );
+};
+
+// Returns the line of the error thrown when reading `csv`, or 0 if no error
+// is thrown.
+std::size_t error_line(char const* csv) {
+    try {
+        hana::experimental::read_csv<Item>(csv);
+    }
+    catch (hana::experimental::csv_error const& e) {
+        return e.line();
+    }
+    return 0;
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,1\n") == 0);
+
+    // missing header
+    BOOST_HANA_RUNTIME_CHECK(error_line("") == 1);
+    BOOST_HANA_RUNTIME_CHECK(error_line("\n\n") == 1);
+
+    // missing and duplicate columns
+    BOOST_HANA_RUNTIME_CHECK(error_line("name\na\n") == 1);
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count,name\na,1,b\n") == 1);
+
+    // wrong number of fields
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,1\nb\n") == 3);
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,1\n\nb,2,3\n") == 4);
+
+    // invalid values
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,1x\n") == 2);
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,\n") == 2);
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\na,99999999999\n") == 2);
+
+    // invalid quotes
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\n\"a\nb\",1\n\"c,2\n") == 4);
+    BOOST_HANA_RUNTIME_CHECK(error_line("name,count\n\"a\"b,1\n") == 2);
+
+    // the message says what is wrong
+    try {
+        hana::experimental::read_csv<Item>("name,count\nx,y\n");
+        BOOST_HANA_RUNTIME_CHECK(false);
+    }
+    catch (hana::experimental::csv_error const& e) {
+        BOOST_HANA_RUNTIME_CHECK(std::string{e.what()} ==
+            "line 2: invalid value 'y' for column 'count'");
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/csv.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Quote {
+    BOOST_HANA_DEFINE_STRUCT(Quote,
+        (std::string, author),
+        (std::string, text),
+        (int, year)
+    );
+};
+
+int main() {
+    auto quotes = hana::experimental::read_csv<Quote>(
+        "author,\"text\",year\n"
+        "\"Knuth, Donald\",\"Premature optimization\nis the root\",1974\n"
+        "Anonymous,\"He said \"\"hi\"\", then \"\"bye\"\"\",\"2000\"\r\n"
+        "\"\",\"\"\"\",0\n"
+        "a\"b,plain,1"
+    );
+    BOOST_HANA_RUNTIME_CHECK(quotes.size() == 4);
+    BOOST_HANA_RUNTIME_CHECK(quotes[0].author == "Knuth, Donald");
+    BOOST_HANA_RUNTIME_CHECK(quotes[0].text == "Premature optimization\nis the root");
+    BOOST_HANA_RUNTIME_CHECK(quotes[0].year == 1974);
+    BOOST_HANA_RUNTIME_CHECK(quotes[1].author == "Anonymous");
+    BOOST_HANA_RUNTIME_CHECK(quotes[1].text == "He said \"hi\", then \"bye\"");
+    BOOST_HANA_RUNTIME_CHECK(quotes[1].year == 2000);
+    BOOST_HANA_RUNTIME_CHECK(quotes[2].author == "");
+    BOOST_HANA_RUNTIME_CHECK(quotes[2].text == "\"");
+    BOOST_HANA_RUNTIME_CHECK(quotes[2].year == 0);
+    BOOST_HANA_RUNTIME_CHECK(quotes[3].author == "a\"b");
+    BOOST_HANA_RUNTIME_CHECK(quotes[3].text == "plain");
+    BOOST_HANA_RUNTIME_CHECK(quotes[3].year == 1);
+}
@@ -0,0 +1,99 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/csv.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (double, height),
+        (bool, active)
+    );
+};
+
+struct Point {
+    long x;
+    unsigned y;
+    char tag;
+};
+BOOST_HANA_ADAPT_STRUCT(Point, x, y, tag);
+
+int main() {
+    // basic records
+    {
+        std::vector<Person> people = hana::experimental::read_csv<Person>(
+            "name,age,height,active\n"
+            "alice,31,1.65,true\n"
+            "bob,-4,2,0\n"
+        );
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "alice");
+        BOOST_HANA_RUNTIME_CHECK(people[0].age == 31);
+        BOOST_HANA_RUNTIME_CHECK(people[0].height == 1.65);
+        BOOST_HANA_RUNTIME_CHECK(people[0].active);
+        BOOST_HANA_RUNTIME_CHECK(people[1].name == "bob");
+        BOOST_HANA_RUNTIME_CHECK(people[1].age == -4);
+        BOOST_HANA_RUNTIME_CHECK(people[1].height == 2.0);
+        BOOST_HANA_RUNTIME_CHECK(!people[1].active);
+    }
+
+    // columns are matched by name, and unknown columns are ignored
+    {
+        std::string csv = "active,comment,height,name,age\r\n"
+                          "1,first,1.5,carol,20\r\n"
+                          "\r\n"
+                          "false,,0.5,dave,7";
+        auto people = hana::experimental::read_csv<Person>(csv);
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people[0].name == "carol");
+        BOOST_HANA_RUNTIME_CHECK(people[0].age == 20);
+        BOOST_HANA_RUNTIME_CHECK(people[0].height == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(people[0].active);
+        BOOST_HANA_RUNTIME_CHECK(people[1].name == "dave");
+        BOOST_HANA_RUNTIME_CHECK(people[1].age == 7);
+        BOOST_HANA_RUNTIME_CHECK(!people[1].active);
+    }
+
+    // floating points which are not plain decimals
+    {
+        auto people = hana::experimental::read_csv<Person>(
+            "name,age,height,active\n"
+            "a,0,1.5e2,1\n"
+            "b,0,-0.000000000000000000000000123,1\n"
+            "c,0,12345678901234567890.5,1\n"
+        );
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(people[0].height == 150.0);
+        BOOST_HANA_RUNTIME_CHECK(people[1].height == -1.23e-25);
+        BOOST_HANA_RUNTIME_CHECK(people[2].height == 12345678901234567890.5);
+    }
+
+    // only a header
+    {
+        auto people = hana::experimental::read_csv<Person>("name,age,height,active\n");
+        BOOST_HANA_RUNTIME_CHECK(people.empty());
+    }
+
+    // adapted structs, other delimiters and a pair of pointers
+    {
+        char const csv[] = "tag;y;x\nA;1;-1\nB;4000000000;9000000000\n";
+        auto points = hana::experimental::read_csv<Point>(csv, csv + sizeof(csv) - 1, ';');
+        BOOST_HANA_RUNTIME_CHECK(points.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(points[0].x == -1);
+        BOOST_HANA_RUNTIME_CHECK(points[0].y == 1);
+        BOOST_HANA_RUNTIME_CHECK(points[0].tag == 'A');
+        BOOST_HANA_RUNTIME_CHECK(points[1].x == 9000000000L);
+        BOOST_HANA_RUNTIME_CHECK(points[1].y == 4000000000u);
+        BOOST_HANA_RUNTIME_CHECK(points[1].tag == 'B');
+    }
+}
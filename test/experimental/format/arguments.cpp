@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <climits>
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename ...Args>
+std::string fmt(Args const& ...args) {
+    char buffer[256];
+    hana::experimental::format(BOOST_HANA_STRING("{}"))(buffer, sizeof(buffer), args...);
+    return buffer;
+}
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (Point, position)
+    );
+};
+
+int main() {
+    // bool and char
+    BOOST_HANA_RUNTIME_CHECK(fmt(true) == "true");
+    BOOST_HANA_RUNTIME_CHECK(fmt(false) == "false");
+    BOOST_HANA_RUNTIME_CHECK(fmt('x') == "x");
+
+    // integers
+    BOOST_HANA_RUNTIME_CHECK(fmt(0) == "0");
+    BOOST_HANA_RUNTIME_CHECK(fmt(-7) == "-7");
+    BOOST_HANA_RUNTIME_CHECK(fmt(1234567890u) == "1234567890");
+    BOOST_HANA_RUNTIME_CHECK(fmt(INT_MIN) == std::to_string(INT_MIN));
+    BOOST_HANA_RUNTIME_CHECK(fmt(LLONG_MIN) == std::to_string(LLONG_MIN));
+    BOOST_HANA_RUNTIME_CHECK(fmt(ULLONG_MAX) == std::to_string(ULLONG_MAX));
+    BOOST_HANA_RUNTIME_CHECK(fmt(static_cast<short>(-12)) == "-12");
+    BOOST_HANA_RUNTIME_CHECK(fmt(static_cast<unsigned char>(200)) == "200");
+
+    // floating points
+    BOOST_HANA_RUNTIME_CHECK(fmt(0.0) == "0.000000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(1.5) == "1.500000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(-2.25f) == "-2.250000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(0.9999999) == "1.000000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(123456.0000004) == "123456.000000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(1e20) == "100000000000000000000.000000");
+    BOOST_HANA_RUNTIME_CHECK(fmt(1.0 / 0.0) == "inf");
+    BOOST_HANA_RUNTIME_CHECK(fmt(-1.0 / 0.0) == "-inf");
+
+    // strings
+    char const* null = nullptr;
+    char array[] = "array";
+    BOOST_HANA_RUNTIME_CHECK(fmt("literal") == "literal");
+    BOOST_HANA_RUNTIME_CHECK(fmt(array) == "array");
+    BOOST_HANA_RUNTIME_CHECK(fmt(null) == "(null)");
+    BOOST_HANA_RUNTIME_CHECK(fmt(std::string{"std::string"}) == "std::string");
+    BOOST_HANA_RUNTIME_CHECK(fmt(BOOST_HANA_STRING("hana")) == "hana");
+    BOOST_HANA_RUNTIME_CHECK(fmt(BOOST_HANA_STRING_REF("string_ref")) == "string_ref");
+
+    // Structs, recursively
+    BOOST_HANA_RUNTIME_CHECK(fmt(Point{1, -2}) == "{x: 1, y: -2}");
+    BOOST_HANA_RUNTIME_CHECK(
+        fmt(Person{"Alice", Point{3, 4}}) == "{name: Alice, position: {x: 3, y: 4}}"
+    );
+}
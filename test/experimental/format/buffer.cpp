@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto f = hana::experimental::format(BOOST_HANA_STRING("x={} y={}"));
+
+    // like snprintf, the output is truncated and null-terminated, and the
+    // full length is returned
+    {
+        char buffer[6] = {'#', '#', '#', '#', '#', '#'};
+        std::size_t n = f(buffer, sizeof(buffer), 123, "abc");
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "x=123") == 0);
+    }
+    {
+        char buffer[12];
+        std::size_t n = f(buffer, sizeof(buffer), 123, "abc");
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "x=123 y=abc") == 0);
+    }
+    {
+        char buffer[1] = {'#'};
+        std::size_t n = f(buffer, sizeof(buffer), 123, "abc");
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == '\0');
+    }
+    {
+        char buffer[1] = {'#'};
+        std::size_t n = f(buffer, 0, 123, "abc");
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == '#');
+    }
+}
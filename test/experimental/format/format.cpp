@@ -0,0 +1,49 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+using hana::experimental::format;
+
+
+template <typename Formatter, typename ...Args>
+std::string run(Formatter f, Args const& ...args) {
+    char buffer[256];
+    std::size_t n = f(buffer, sizeof(buffer), args...);
+    BOOST_HANA_RUNTIME_CHECK(n == std::strlen(buffer));
+    return buffer;
+}
+
+int main() {
+    // literal text only
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING(""))) == "");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("abc"))) == "abc");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("{{}}"))) == "{}");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("a{{b}}c"))) == "a{b}c");
+
+    // placeholders at different positions
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("{}")), 1) == "1");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("a{}")), 1) == "a1");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("{}b")), 1) == "1b");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("{}{}")), 1, 2) == "12");
+    BOOST_HANA_RUNTIME_CHECK(run(format(BOOST_HANA_STRING("{{{}}}")), 1) == "{1}");
+    BOOST_HANA_RUNTIME_CHECK(
+        run(format(BOOST_HANA_STRING_REF("id={} name={} ok={}")), 42, "bob", true)
+            == "id=42 name=bob ok=true"
+    );
+
+    // arity
+    {
+        auto f0 = format(BOOST_HANA_STRING(""));
+        auto f2 = format(BOOST_HANA_STRING("{}{{}}{}"));
+        static_assert(decltype(f0)::arity == 0, "");
+        static_assert(decltype(f2)::arity == 2, "");
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <stdexcept>
+namespace hana = boost::hana;
+
+
+int live = 0;
+
+struct Counted {
+    Counted() { ++live; }
+    Counted(Counted const&) { ++live; }
+    ~Counted() { --live; }
+};
+
+template <typename Executor>
+void test(Executor&& executor) {
+    // the other tasks still run, and the exception is rethrown
+    {
+        std::atomic<int> calls{0};
+        bool caught = false;
+        try {
+            hana::experimental::parallel_for_each(hana::make_tuple(1, 2, 3), [&](int x) {
+                ++calls;
+                if (x == 2)
+                    throw std::runtime_error{"2"};
+            }, executor);
+        } catch (std::runtime_error const& e) {
+            caught = true;
+            BOOST_HANA_RUNTIME_CHECK(e.what() == std::string{"2"});
+        }
+        BOOST_HANA_RUNTIME_CHECK(caught);
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+
+    // the results that were computed are destroyed
+    {
+        bool caught = false;
+        try {
+            hana::experimental::parallel_transform(hana::make_tuple(1, 2, 3), [](int x) {
+                if (x == 3)
+                    throw std::runtime_error{"3"};
+                return Counted{};
+            }, executor);
+        } catch (std::runtime_error const&) {
+            caught = true;
+        }
+        BOOST_HANA_RUNTIME_CHECK(caught);
+        BOOST_HANA_RUNTIME_CHECK(live == 0);
+    }
+}
+
+int main() {
+    hana::experimental::thread_pool pool{2};
+    test(pool);
+    test(hana::experimental::inline_executor{});
+}
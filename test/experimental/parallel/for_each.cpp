@@ -0,0 +1,94 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+namespace hana = boost::hana;
+
+
+void assign(int& i) { i = 1; }
+void assign(std::string& s) { s = "x"; }
+void assign(double& d) { d = 1.5; }
+
+int main() {
+    hana::experimental::thread_pool pool{4};
+
+    // with an empty tuple
+    {
+        hana::experimental::parallel_for_each(hana::make_tuple(), [](auto) {
+            BOOST_HANA_RUNTIME_CHECK(false);
+        }, pool);
+    }
+
+    // heterogeneous elements are all processed once the call returns
+    {
+        int i = 0;
+        std::string s;
+        double d = 0;
+        auto xs = hana::make_tuple(&i, &s, &d);
+        std::atomic<int> calls{0};
+        hana::experimental::parallel_for_each(xs, [&](auto* x) {
+            assign(*x);
+            ++calls;
+        }, pool);
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+        BOOST_HANA_RUNTIME_CHECK(i == 1);
+        BOOST_HANA_RUNTIME_CHECK(s == "x");
+        BOOST_HANA_RUNTIME_CHECK(d == 1.5);
+    }
+
+    // elements are passed by reference
+    {
+        auto xs = hana::make_tuple(1, 2l, 3u);
+        hana::experimental::parallel_for_each(xs, [](auto& x) { x *= 10; }, pool);
+        BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple(10, 20l, 30u));
+    }
+
+    // the work is actually spread over the threads of the pool
+    {
+        std::atomic<int> waiting{0};
+        hana::experimental::parallel_for_each(hana::make_tuple(1, 2, 3, 4), [&](int) {
+            ++waiting;
+            while (waiting != 4)
+                std::this_thread::yield();
+        }, pool);
+        BOOST_HANA_RUNTIME_CHECK(waiting == 4);
+    }
+
+    // nested calls don't deadlock, even with a single thread
+    {
+        hana::experimental::thread_pool single{1};
+        std::atomic<int> calls{0};
+        hana::experimental::parallel_for_each(hana::make_tuple(1, 2), [&](int) {
+            hana::experimental::parallel_for_each(hana::make_tuple(1, 2, 3), [&](int) {
+                ++calls;
+            }, single);
+        }, single);
+        BOOST_HANA_RUNTIME_CHECK(calls == 6);
+    }
+
+    // with the inline executor, elements are processed in order
+    {
+        std::string order;
+        hana::experimental::parallel_for_each(hana::make_tuple('a', "b", std::string{"c"}), [&](auto const& x) {
+            order += x;
+        }, hana::experimental::inline_executor{});
+        BOOST_HANA_RUNTIME_CHECK(order == "abc");
+    }
+
+    // with the default thread pool
+    {
+        std::atomic<int> calls{0};
+        hana::experimental::parallel_for_each(hana::make_tuple(1, '2', 3.0), [&](auto) {
+            ++calls;
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/parallel.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct NotDefaultConstructible {
+    explicit NotDefaultConstructible(int v) : value{v} { }
+    int value;
+};
+
+int main() {
+    hana::experimental::thread_pool pool{3};
+
+    // with an empty tuple
+    {
+        auto result = hana::experimental::parallel_transform(hana::make_tuple(), [](auto x) {
+            return x;
+        }, pool);
+        BOOST_HANA_CONSTANT_CHECK(result == hana::make_tuple());
+    }
+
+    // results are in order, even when they are computed out of order
+    {
+        auto result = hana::experimental::parallel_transform(hana::make_tuple(3, 'x', 1.5), [](auto x) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{
+                std::is_same<decltype(x), int>::value ? 20 : 0
+            });
+            return hana::make_tuple(x);
+        }, pool);
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(
+            hana::make_tuple(3), hana::make_tuple('x'), hana::make_tuple(1.5)
+        ));
+    }
+
+    // results can be move-only and not default-constructible
+    {
+        auto result = hana::experimental::parallel_transform(hana::make_tuple(1, 2), [](int x) {
+            return std::make_unique<NotDefaultConstructible>(x);
+        }, pool);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(result)->value == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(result)->value == 2);
+    }
+
+    // elements of an rvalue sequence are moved to the function
+    {
+        auto result = hana::experimental::parallel_transform(
+            hana::make_tuple(std::make_unique<int>(1), std::make_unique<int>(2)),
+            [](std::unique_ptr<int> p) { *p += 1; return p; },
+            pool);
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<0>(result) == 2);
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_c<1>(result) == 3);
+    }
+
+    // references are decayed, like hana::transform does
+    {
+        int i = 1;
+        std::string s = "abc";
+        auto refs = hana::make_tuple(&i, &s);
+        auto result = hana::experimental::parallel_transform(refs, [](auto* p) -> auto& {
+            return *p;
+        }, pool);
+        static_assert(std::is_same<decltype(result), hana::tuple<int, std::string>>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(result == hana::make_tuple(1, std::string{"abc"}));
+    }
+
+    // with the inline executor and the default thread pool
+    {
+        auto f = [](auto x) { return x + x; };
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::parallel_transform(hana::make_tuple(1, std::string{"a"}), f,
+                                                   hana::experimental::inline_executor{})
+            == hana::make_tuple(2, std::string{"aa"})
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::experimental::parallel_transform(hana::make_tuple(1, std::string{"a"}), f)
+            == hana::make_tuple(2, std::string{"aa"})
+        );
+    }
+}
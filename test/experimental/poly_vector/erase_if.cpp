@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/poly_vector.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+bool is_big(int i) { return i > 10; }
+bool is_big(std::string const& s) { return s.size() > 2; }
+
+int main() {
+    hana::experimental::poly_vector<int, std::string> v;
+    v.insert(1);
+    v.insert(20);
+    v.insert(3);
+    v.insert(40);
+    v.insert(std::string{"a"});
+    v.insert(std::string{"abc"});
+
+    // nothing to erase
+    BOOST_HANA_RUNTIME_CHECK(v.erase_if([](auto const&) { return false; }) == 0);
+    BOOST_HANA_RUNTIME_CHECK(v.size() == 6);
+
+    // the predicate is called statically on each type, and the order of
+    // the remaining objects is preserved
+    BOOST_HANA_RUNTIME_CHECK(v.erase_if([](auto const& x) { return is_big(x); }) == 3);
+    BOOST_HANA_RUNTIME_CHECK(v.segment<int>() == (std::vector<int>{1, 3}));
+    BOOST_HANA_RUNTIME_CHECK(v.segment<std::string>() == std::vector<std::string>{"a"});
+
+    // erase everything
+    BOOST_HANA_RUNTIME_CHECK(v.erase_if([](auto const&) { return true; }) == 3);
+    BOOST_HANA_RUNTIME_CHECK(v.empty());
+}
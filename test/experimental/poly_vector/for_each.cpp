@@ -0,0 +1,55 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/poly_vector.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+std::string describe(int i) { return "i" + std::to_string(i); }
+std::string describe(std::string const& s) { return "s" + s; }
+std::string describe(double d) { return "d" + std::to_string(static_cast<int>(d)); }
+
+int main() {
+    // with an empty poly_vector
+    {
+        hana::experimental::poly_vector<int, double> v;
+        v.for_each([](auto const&) { BOOST_HANA_RUNTIME_CHECK(false); });
+    }
+
+    // objects are visited segment by segment, statically on their type,
+    // in insertion order within a segment
+    {
+        hana::experimental::poly_vector<int, std::string, double> v;
+        v.insert(1);
+        v.insert(std::string{"a"});
+        v.insert(2.0);
+        v.insert(3);
+        v.insert(std::string{"b"});
+
+        std::vector<std::string> seen;
+        v.for_each([&](auto const& x) { seen.push_back(describe(x)); });
+        BOOST_HANA_RUNTIME_CHECK(seen == (std::vector<std::string>{
+            "i1", "i3", "sa", "sb", "d2"
+        }));
+    }
+
+    // objects can be modified through a non-const poly_vector
+    {
+        hana::experimental::poly_vector<int, std::string> v;
+        v.insert(1);
+        v.insert(std::string{"a"});
+        v.for_each([](auto& x) { x = x + x; });
+        BOOST_HANA_RUNTIME_CHECK(v.segment<int>() == std::vector<int>{2});
+        BOOST_HANA_RUNTIME_CHECK(v.segment<std::string>() == std::vector<std::string>{"aa"});
+
+        auto const& cv = v;
+        int count = 0;
+        cv.for_each([&](auto const&) { ++count; });
+        BOOST_HANA_RUNTIME_CHECK(count == 2);
+    }
+}
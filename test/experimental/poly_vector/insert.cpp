@@ -0,0 +1,61 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/poly_vector.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct point {
+    point(int x, int y) : x(x), y(y) { }
+    int x, y;
+};
+
+int main() {
+    hana::experimental::poly_vector<int, std::string, point> v;
+    BOOST_HANA_RUNTIME_CHECK(v.empty());
+    BOOST_HANA_RUNTIME_CHECK(v.size() == 0);
+
+    // objects are inserted in the segment of their decayed type
+    {
+        int i = 1;
+        v.insert(i);
+        v.insert(2);
+        std::string const s = "abc";
+        v.insert(s);
+        v.insert(std::string{"def"});
+        v.insert(point{1, 2});
+
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 5);
+        BOOST_HANA_RUNTIME_CHECK(!v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.segment<int>() == (std::vector<int>{1, 2}));
+        BOOST_HANA_RUNTIME_CHECK(v.segment<std::string>() ==
+                                 (std::vector<std::string>{"abc", "def"}));
+        BOOST_HANA_RUNTIME_CHECK(v.segment<point>().size() == 1);
+    }
+
+    // emplace constructs in place and returns a reference to the object
+    {
+        point& p = v.emplace<point>(3, 4);
+        BOOST_HANA_RUNTIME_CHECK(&p == &v.segment<point>().back());
+        BOOST_HANA_RUNTIME_CHECK(p.x == 3 && p.y == 4);
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 6);
+    }
+
+    // segments are accessible through a const poly_vector
+    {
+        auto const& cv = v;
+        BOOST_HANA_RUNTIME_CHECK(cv.segment<int>().size() == 2);
+    }
+
+    // clear empties all the segments
+    {
+        v.clear();
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.segment<std::string>().empty());
+    }
+}
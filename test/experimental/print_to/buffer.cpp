@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto xs = hana::make_tuple(1, 'x', "abc");
+
+    // like snprintf, the output is truncated and null-terminated, and the
+    // full length is returned
+    {
+        char buffer[6] = {'#', '#', '#', '#', '#', '#'};
+        std::size_t n = hana::experimental::print_to(buffer, sizeof(buffer), xs);
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "(1, x") == 0);
+    }
+    {
+        char buffer[12];
+        std::size_t n = hana::experimental::print_to(buffer, sizeof(buffer), xs);
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "(1, x, abc)") == 0);
+    }
+    {
+        char buffer[1] = {'#'};
+        std::size_t n = hana::experimental::print_to(buffer, 0, xs);
+        BOOST_HANA_RUNTIME_CHECK(n == 11);
+        BOOST_HANA_RUNTIME_CHECK(buffer[0] == '#');
+    }
+
+    // writing through a raw pointer used as an output iterator
+    {
+        char buffer[16] = {};
+        char* end = hana::experimental::print_to(buffer + 0, xs);
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + 11);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(buffer, "(1, x, abc)") == 0);
+    }
+}
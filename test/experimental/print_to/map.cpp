@@ -0,0 +1,49 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_map()) == "{}");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_map(hana::make_pair(hana::int_c<1>, 'x'))
+    ) == "{1 => x}");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_map(hana::make_pair(hana::int_c<1>, 'x'),
+                       hana::make_pair(hana::int_c<2>, 'y'),
+                       hana::make_pair(hana::int_c<3>, 'z'))
+    ) == "{1 => x, 2 => y, 3 => z}");
+
+    // nested in other containers
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_map(hana::make_pair(BOOST_HANA_STRING("a"), hana::make_tuple(1, 2)),
+                       hana::make_pair(BOOST_HANA_STRING("b"), hana::make_map()))
+    ) == "{\"a\" => (1, 2), \"b\" => {}}");
+
+    // sets
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_set()) == "{}");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_set(hana::int_c<1>)) == "{1}");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_set(hana::int_c<1>, hana::int_c<2>, hana::int_c<3>)
+    ) == "{1, 2, 3}");
+}
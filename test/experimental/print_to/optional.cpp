@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(print(hana::nothing) == "nothing");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::just(1)) == "just(1)");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::just(hana::just('x'))) == "just(just(x))");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_tuple(hana::just(hana::make_tuple(1, 2)), hana::nothing)
+    ) == "(just((1, 2)), nothing)");
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_tuple()) == "()");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_tuple(1)) == "(1)");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_tuple(1, 'x')) == "(1, x)");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_tuple(1, 'x', "abc")) == "(1, x, abc)");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_tuple(hana::int_c<1>, -2l, 3u)) == "(1, -2, 3)");
+
+    // nested sequences
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_tuple(1, hana::make_tuple(), hana::make_tuple('x', hana::make_tuple(2)))
+    ) == "(1, (), (x, (2)))");
+
+    // Products
+    BOOST_HANA_RUNTIME_CHECK(print(hana::make_pair(1, 'x')) == "(1, x)");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_pair(hana::make_tuple(1, 2), hana::make_pair('x', 'y'))
+    ) == "((1, 2), (x, y))");
+}
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+int main() {
+    // compile-time strings are quoted, runtime strings are not
+    BOOST_HANA_RUNTIME_CHECK(print(BOOST_HANA_STRING("")) == "\"\"");
+    BOOST_HANA_RUNTIME_CHECK(print(BOOST_HANA_STRING("abc")) == "\"abc\"");
+    BOOST_HANA_RUNTIME_CHECK(print(BOOST_HANA_STRING_REF("abc")) == "\"abc\"");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_tuple(BOOST_HANA_STRING("abc"), "def", std::string{"ghi"})
+    ) == "(\"abc\", def, ghi)");
+}
@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Point {
+    int x;
+    int y;
+};
+BOOST_HANA_ADAPT_STRUCT(Point, x, y);
+
+struct Shape {
+    std::string name;
+    hana::tuple<Point, Point> corners;
+    hana::optional<int> depth;
+};
+BOOST_HANA_ADAPT_STRUCT(Shape, name, corners, depth);
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(print(Point{1, -2}) == "{x: 1, y: -2}");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        Shape{"square", hana::make_tuple(Point{0, 0}, Point{3, 3}), hana::just(2)}
+    ) == "{name: square, corners: ({x: 0, y: 0}, {x: 3, y: 3}), depth: just(2)}");
+}
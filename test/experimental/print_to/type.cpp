@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/print_to.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <iterator>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T>
+std::string print(T const& t) {
+    std::string s;
+    hana::experimental::print_to(std::back_inserter(s), t);
+    return s;
+}
+
+template <typename ...T>
+struct Template { };
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(print(hana::type_c<void>) == "type<void>");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::type_c<int>) == "type<int>");
+    BOOST_HANA_RUNTIME_CHECK(print(hana::type_c<Template<>>) == "type<Template<> >"
+                          || print(hana::type_c<Template<>>) == "type<Template<>>");
+    BOOST_HANA_RUNTIME_CHECK(print(
+        hana::make_tuple(hana::type_c<char>, hana::type_c<long>)
+    ) == "(type<char>, type<long int>)");
+}
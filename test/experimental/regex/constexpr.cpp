@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/regex.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+constexpr char date[] = "2017-03-14";
+constexpr char not_a_date[] = "2017-3-14";
+
+int main() {
+    constexpr auto re = hana::experimental::make_regex(
+        hana::string_c<'\\', 'd', '{', '4', '}', '-', '\\', 'd', '{', '2', '}',
+                       '-', '\\', 'd', '{', '2', '}'>
+    );
+
+    // matching can happen at compile-time
+    static_assert(re.match(date, date + sizeof(date) - 1), "");
+    static_assert(!re.match(not_a_date, not_a_date + sizeof(not_a_date) - 1), "");
+
+    // null-terminated strings and objects with data() and size()
+    BOOST_HANA_RUNTIME_CHECK(re.match("1999-12-31"));
+    BOOST_HANA_RUNTIME_CHECK(!re.match("1999-12-31 "));
+    BOOST_HANA_RUNTIME_CHECK(re.match(std::string{"1999-12-31"}));
+    BOOST_HANA_RUNTIME_CHECK(!re.match(std::string{"99-12-31"}));
+
+    // a hana::string_ref may also be used as a pattern
+    auto keyword = hana::experimental::make_regex(BOOST_HANA_STRING_REF("if|else|while"));
+    BOOST_HANA_RUNTIME_CHECK(keyword.match("else"));
+    BOOST_HANA_RUNTIME_CHECK(!keyword.match("elsewhere"));
+}
@@ -0,0 +1,78 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/regex.hpp>
+#include <boost/hana/string.hpp>
+
+#include <regex>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// Compares the result of matching all the strings of length up to 4 over
+// a small alphabet with the result of std::regex_match.
+std::vector<std::string> const& inputs() {
+    static std::vector<std::string> strings = [] {
+        std::string const alphabet = "ab0_-.\n";
+        std::vector<std::string> result{""};
+        for (std::size_t first = 0, length = 1; length <= 4; ++length) {
+            std::size_t last = result.size();
+            for (std::size_t i = first; i != last; ++i)
+                for (char c : alphabet)
+                    result.push_back(result[i] + c);
+            first = last;
+        }
+        return result;
+    }();
+    return strings;
+}
+
+template <typename Pattern>
+void check(Pattern pattern) {
+    auto re = hana::experimental::make_regex(pattern);
+    std::regex expected{hana::to<char const*>(pattern)};
+    for (std::string const& s : inputs())
+        BOOST_HANA_RUNTIME_CHECK(re.match(s) == std::regex_match(s, expected));
+}
+
+int main() {
+    check(BOOST_HANA_STRING(""));
+    check(BOOST_HANA_STRING("a"));
+    check(BOOST_HANA_STRING("ab"));
+    check(BOOST_HANA_STRING("a|b"));
+    check(BOOST_HANA_STRING("a|"));
+    check(BOOST_HANA_STRING("a*"));
+    check(BOOST_HANA_STRING("a+b"));
+    check(BOOST_HANA_STRING("a?b?"));
+    check(BOOST_HANA_STRING("(ab)*"));
+    check(BOOST_HANA_STRING("(?:a|b0)+"));
+    check(BOOST_HANA_STRING("(a|b)*b(a|b)"));
+    check(BOOST_HANA_STRING("a*?b+?"));
+    check(BOOST_HANA_STRING("."));
+    check(BOOST_HANA_STRING(".*"));
+    check(BOOST_HANA_STRING("\\."));
+    check(BOOST_HANA_STRING("[ab]+"));
+    check(BOOST_HANA_STRING("[^ab]*"));
+    check(BOOST_HANA_STRING("[a-z_][a-z0-9_]*"));
+    check(BOOST_HANA_STRING("[-a]+"));
+    check(BOOST_HANA_STRING("[a-]+"));
+    check(BOOST_HANA_STRING("[\\d.]+"));
+    check(BOOST_HANA_STRING("\\d+"));
+    check(BOOST_HANA_STRING("\\D+"));
+    check(BOOST_HANA_STRING("\\w*"));
+    check(BOOST_HANA_STRING("\\W"));
+    check(BOOST_HANA_STRING("\\s"));
+    check(BOOST_HANA_STRING("\\S*"));
+    check(BOOST_HANA_STRING("a{2}"));
+    check(BOOST_HANA_STRING("a{2,}"));
+    check(BOOST_HANA_STRING("a{1,3}"));
+    check(BOOST_HANA_STRING("a{0,2}b{0}"));
+    check(BOOST_HANA_STRING("(a|b){2}0?"));
+    check(BOOST_HANA_STRING("(a{1,2}b){1,2}"));
+    check(BOOST_HANA_STRING("^a*$"));
+    check(BOOST_HANA_STRING("a(b|)0"));
+    check(BOOST_HANA_STRING("((a|_)(b|-))*"));
+}
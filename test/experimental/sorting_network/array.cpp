@@ -0,0 +1,72 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/sorting_network.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// By the 0-1 principle, a network sorts every input if and only if it sorts
+// every sequence of 0s and 1s.
+template <std::size_t N>
+void check_zero_one() {
+    for (std::uint32_t bits = 0; bits != (std::uint32_t{1} << N); ++bits) {
+        std::array<int, N> xs;
+        for (std::size_t i = 0; i != N; ++i)
+            xs[i] = (bits >> i) & 1;
+        hana::experimental::sorting_network<N>::sort(xs);
+        BOOST_HANA_RUNTIME_CHECK(std::is_sorted(xs.begin(), xs.end()));
+    }
+}
+
+template <typename T, std::size_t N>
+void check_random(std::mt19937& gen) {
+    std::uniform_int_distribution<int> dist{-100, 100};
+    for (int n = 0; n != 100; ++n) {
+        std::array<T, N> xs;
+        for (auto& x : xs)
+            x = static_cast<T>(dist(gen));
+        std::array<T, N> expected = xs;
+        std::sort(expected.begin(), expected.end());
+        hana::experimental::sorting_network<N>::sort(xs);
+        BOOST_HANA_RUNTIME_CHECK(xs == expected);
+    }
+}
+
+template <std::size_t ...N>
+void check_zero_one(std::index_sequence<N...>) {
+    using Swallow = int[];
+    (void)Swallow{0, (check_zero_one<N>(), 0)...};
+}
+
+template <typename T, std::size_t ...N>
+void check_random(std::mt19937& gen, std::index_sequence<N...>) {
+    using Swallow = int[];
+    (void)Swallow{0, (check_random<T, N>(gen), 0)...};
+}
+
+int main() {
+    check_zero_one(std::make_index_sequence<17>{});
+
+    std::mt19937 gen;
+    check_random<int>(gen, std::make_index_sequence<20>{});
+    check_random<float>(gen, std::index_sequence<31, 32, 33, 64, 100>{});
+    check_random<double>(gen, std::index_sequence<9, 16, 48>{});
+    check_random<std::uint8_t>(gen, std::index_sequence<5, 24>{});
+
+    // number of comparators
+    static_assert(hana::experimental::sorting_network<0>::comparators == 0, "");
+    static_assert(hana::experimental::sorting_network<1>::comparators == 0, "");
+    static_assert(hana::experimental::sorting_network<2>::comparators == 1, "");
+    static_assert(hana::experimental::sorting_network<4>::comparators == 5, "");
+    static_assert(hana::experimental::sorting_network<8>::comparators == 19, "");
+    static_assert(hana::experimental::sorting_network<16>::comparators == 63, "");
+}
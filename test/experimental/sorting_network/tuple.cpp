@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/sorting_network.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <std::size_t N, typename Xs>
+constexpr Xs sorted(Xs xs) {
+    hana::experimental::sorting_network<N>::sort(xs);
+    return xs;
+}
+
+int main() {
+    static_assert(hana::equal(
+        sorted<0>(hana::make_tuple()),
+        hana::make_tuple()
+    ), "");
+
+    static_assert(hana::equal(
+        sorted<1>(hana::make_tuple(3)),
+        hana::make_tuple(3)
+    ), "");
+
+    static_assert(hana::equal(
+        sorted<4>(hana::make_tuple(3, 1, 4, 1)),
+        hana::make_tuple(1, 1, 3, 4)
+    ), "");
+
+    static_assert(hana::equal(
+        sorted<10>(hana::make_tuple(9, 2, 6, 5, 3, 5, 8, 9, 7, 0)),
+        hana::make_tuple(0, 2, 3, 5, 5, 6, 7, 8, 9, 9)
+    ), "");
+
+    hana::tuple<double, double, double> xs{2.5, -1.0, 0.5};
+    hana::experimental::sorting_network<3>::sort(xs);
+    BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple(-1.0, 0.5, 2.5));
+}
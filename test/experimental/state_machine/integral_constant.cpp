@@ -0,0 +1,74 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <random>
+namespace hana = boost::hana;
+namespace ex = hana::experimental;
+
+
+// A machine with N states where the event e moves from the state s to the
+// state (s + e + 1) % N, checked against the same machine computed by hand.
+template <int N, int E, typename Transitions>
+void check(Transitions transitions, int first_event) {
+    auto machine = ex::make_state_machine(hana::int_c<0>, transitions);
+    static_assert(decltype(machine)::states() == N, "");
+    static_assert(decltype(machine)::events() == E, "");
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(first_event - 2, first_event + E + 1);
+    int state = 0;
+    for (int i = 0; i != 1000; ++i) {
+        int e = dist(gen);
+        bool valid = e >= first_event && e < first_event + E;
+        BOOST_HANA_RUNTIME_CHECK(machine.process(e) == valid);
+        if (valid)
+            state = (state + (e - first_event) + 1) % N;
+        BOOST_HANA_RUNTIME_CHECK(machine.state() == static_cast<std::size_t>(state));
+    }
+}
+
+int main() {
+    // Consecutive events
+    {
+        auto t = [](auto s, auto e) {
+            return ex::transition(s, e, hana::int_c<(decltype(s)::value + decltype(e)::value + 1) % 3>);
+        };
+        check<3, 2>(hana::make_tuple(
+            t(hana::int_c<0>, hana::int_c<0>), t(hana::int_c<0>, hana::int_c<1>),
+            t(hana::int_c<1>, hana::int_c<0>), t(hana::int_c<1>, hana::int_c<1>),
+            t(hana::int_c<2>, hana::int_c<0>), t(hana::int_c<2>, hana::int_c<1>)
+        ), 0);
+    }
+
+    // Events with gaps are searched
+    {
+        int calls = 0;
+        auto count = [&](auto e) { calls += decltype(e)::value; };
+        auto machine = ex::make_state_machine(hana::int_c<0>, hana::make_tuple(
+            ex::transition(hana::int_c<0>, hana::int_c<10>, count, hana::int_c<1>),
+            ex::transition(hana::int_c<1>, hana::int_c<-5>, count, hana::int_c<0>),
+            ex::transition(hana::int_c<1>, hana::int_c<10>, count, hana::int_c<1>)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(!machine.process(-5));
+        BOOST_HANA_RUNTIME_CHECK(!machine.process(0));
+        BOOST_HANA_RUNTIME_CHECK(machine.process(10));
+        BOOST_HANA_RUNTIME_CHECK(machine.is(hana::int_c<1>));
+        BOOST_HANA_RUNTIME_CHECK(machine.process(10));
+        BOOST_HANA_RUNTIME_CHECK(machine.process(-5));
+        BOOST_HANA_RUNTIME_CHECK(machine.is(hana::int_c<0>));
+        BOOST_HANA_RUNTIME_CHECK(calls == 15);
+
+        // Events known at compile-time
+        BOOST_HANA_RUNTIME_CHECK(!machine.process(hana::int_c<-5>));
+        BOOST_HANA_RUNTIME_CHECK(machine.process(hana::int_c<10>));
+        BOOST_HANA_RUNTIME_CHECK(machine.is(hana::int_c<1>));
+        BOOST_HANA_RUNTIME_CHECK(calls == 25);
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/state_machine.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+namespace ex = hana::experimental;
+
+
+struct Idle { };
+struct Running { };
+struct Stopped { };
+
+struct start { int speed; };
+struct stop { };
+struct reset { };
+
+int main() {
+    std::vector<std::string> log;
+    int speed = 0;
+
+    auto machine = ex::make_state_machine(hana::type_c<Idle>, hana::make_tuple(
+        ex::transition(hana::type_c<Idle>, hana::type_c<start>,
+                       [&](start const& e) { speed = e.speed; log.push_back("start"); },
+                       hana::type_c<Running>),
+        ex::transition(hana::type_c<Running>, hana::type_c<stop>,
+                       [&] { log.push_back("stop"); },
+                       hana::type_c<Stopped>),
+        ex::transition(hana::type_c<Stopped>, hana::type_c<reset>,
+                       hana::type_c<Idle>)
+    ));
+
+    static_assert(decltype(machine)::states() == 3, "");
+    static_assert(decltype(machine)::events() == 3, "");
+    BOOST_HANA_RUNTIME_CHECK(machine.is(hana::type_c<Idle>));
+    BOOST_HANA_RUNTIME_CHECK(machine.state() == 0);
+
+    // Events without a transition from the current state are ignored
+    BOOST_HANA_RUNTIME_CHECK(!machine.process(stop{}));
+    BOOST_HANA_RUNTIME_CHECK(!machine.process(reset{}));
+    BOOST_HANA_RUNTIME_CHECK(machine.is(hana::type_c<Idle>));
+    BOOST_HANA_RUNTIME_CHECK(log.empty());
+
+    // Actions receive the event when they accept it
+    BOOST_HANA_RUNTIME_CHECK(machine.process(start{3}));
+    BOOST_HANA_RUNTIME_CHECK(machine.is(hana::type_c<Running>));
+    BOOST_HANA_RUNTIME_CHECK(speed == 3);
+    BOOST_HANA_RUNTIME_CHECK(!machine.process(start{4}));
+    BOOST_HANA_RUNTIME_CHECK(speed == 3);
+
+    // Events may also be given as hana::types
+    BOOST_HANA_RUNTIME_CHECK(machine.process(hana::type_c<stop>));
+    BOOST_HANA_RUNTIME_CHECK(machine.is(hana::type_c<Stopped>));
+
+    // Transitions without an action
+    BOOST_HANA_RUNTIME_CHECK(machine.process(reset{}));
+    BOOST_HANA_RUNTIME_CHECK(machine.is(hana::type_c<Idle>));
+
+    BOOST_HANA_RUNTIME_CHECK((log == std::vector<std::string>{"start", "stop"}));
+
+    // A single transition
+    {
+        auto empty = ex::make_state_machine(hana::type_c<Idle>, hana::make_tuple(
+            ex::transition(hana::type_c<Idle>, hana::type_c<start>, hana::type_c<Running>)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(empty.process(start{0}));
+        BOOST_HANA_RUNTIME_CHECK(empty.is(hana::type_c<Running>));
+        BOOST_HANA_RUNTIME_CHECK(!empty.process(start{0}));
+    }
+}
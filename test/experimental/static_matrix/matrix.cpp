@@ -0,0 +1,106 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/static_matrix.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+using hana::experimental::static_matrix;
+using hana::experimental::static_vector;
+
+
+auto row = hana::make_tuple;
+auto rows = hana::make_tuple;
+
+int main() {
+    // to_static_matrix
+    {
+        constexpr auto m = hana::experimental::to_static_matrix(rows(
+            row(1, 2, 3),
+            row(4, 5, 6)
+        ));
+        static_assert(m.rows() == 2 && m.columns() == 3, "");
+        static_assert(m(0, 0) == 1 && m(0, 2) == 3 && m(1, 0) == 4 && m(1, 2) == 6, "");
+        static_assert(m == static_matrix<int, 2, 3>{{1, 2, 3, 4, 5, 6}}, "");
+    }
+
+    // element-wise operations
+    {
+        constexpr static_matrix<int, 2, 2> a{{1, 2, 3, 4}};
+        constexpr static_matrix<int, 2, 2> b{{4, 3, 2, 1}};
+        static_assert(a + b == static_matrix<int, 2, 2>{{5, 5, 5, 5}}, "");
+        static_assert(a - b == static_matrix<int, 2, 2>{{-3, -1, 1, 3}}, "");
+        static_assert(3 * a == static_matrix<int, 2, 2>{{3, 6, 9, 12}}, "");
+    }
+
+    // multiplication and transpose
+    {
+        constexpr static_matrix<int, 2, 3> a{{1, 2, 3,
+                                              4, 5, 6}};
+        constexpr static_matrix<int, 3, 2> b{{7,  8,
+                                              9,  10,
+                                              11, 12}};
+        static_assert(a * b == static_matrix<int, 2, 2>{{58, 64, 139, 154}}, "");
+        static_assert(hana::experimental::transpose(a) ==
+                      static_matrix<int, 3, 2>{{1, 4, 2, 5, 3, 6}}, "");
+
+        constexpr static_vector<int, 3> v{{1, 0, -1}};
+        static_assert(a * v == static_vector<int, 2>{{-2, -2}}, "");
+    }
+
+    // determinant
+    {
+        using hana::experimental::determinant;
+        using hana::experimental::to_static_matrix;
+
+        static_assert(determinant(to_static_matrix(rows(row(2)))) == 2, "");
+        static_assert(determinant(to_static_matrix(rows(row(1, 2), row(3, 4)))) == -2, "");
+        static_assert(determinant(to_static_matrix(rows(
+            row(1, 5, 6),
+            row(3, 2, 4),
+            row(7, 8, 9)
+        ))) == 51, "");
+        static_assert(determinant(to_static_matrix(rows(
+            row(1, 5, 6, -3),
+            row(3, 2, 4, -5),
+            row(7, 8, 9, -1),
+            row(8, 2, 1, 10)
+        ))) == 214, "");
+        static_assert(determinant(to_static_matrix(rows(
+            row(1,  5,  6, -3, 92),
+            row(3,  2,  4, -5, 13),
+            row(7,  8,  9, -1, 0),
+            row(8,  2,  1, 10, 41),
+            row(3, 12, 92, -7, -4)
+        ))) == -3115014, "");
+
+        // a zero pivot requires swapping rows
+        static_assert(determinant(to_static_matrix(rows(
+            row(0, 1, 0, 0, 0),
+            row(1, 0, 0, 0, 0),
+            row(0, 0, 2, 0, 0),
+            row(0, 0, 0, 3, 0),
+            row(0, 0, 0, 0, 1)
+        ))) == -6, "");
+
+        // singular matrix
+        static_assert(determinant(to_static_matrix(rows(
+            row(1, 2, 3, 4, 0),
+            row(2, 4, 6, 8, 0),
+            row(0, 1, 0, 1, 0),
+            row(5, 0, 5, 0, 0),
+            row(0, 0, 0, 0, 1)
+        ))) == 0, "");
+
+        // floating point
+        double d = determinant(to_static_matrix(rows(
+            row(2.0, 0.0, 0.0, 1.0, 0.0),
+            row(0.0, 3.0, 0.0, 0.0, 0.0),
+            row(0.0, 0.0, 4.0, 0.0, 0.0),
+            row(1.0, 0.0, 0.0, 2.0, 0.0),
+            row(0.0, 0.0, 0.0, 0.0, 0.5)
+        )));
+        BOOST_HANA_RUNTIME_CHECK(d > 17.999 && d < 18.001);
+    }
+}
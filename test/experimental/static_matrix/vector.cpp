@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/static_matrix.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+using hana::experimental::static_vector;
+
+
+int main() {
+    // to_static_vector
+    {
+        constexpr auto v = hana::experimental::to_static_vector(hana::make_tuple(1, 2, 3));
+        static_assert(v.size() == 3, "");
+        static_assert(v[0] == 1 && v[1] == 2 && v[2] == 3, "");
+        static_assert(v == static_vector<int, 3>{{1, 2, 3}}, "");
+        static_assert(v != static_vector<int, 3>{{1, 2, 4}}, "");
+    }
+
+    // storage is contiguous and aligned
+    {
+        static_assert(sizeof(static_vector<float, 4>) == 4 * sizeof(float), "");
+        static_assert(alignof(static_vector<float, 4>) == 16, "");
+        static_assert(alignof(static_vector<double, 4>) == 32, "");
+        static_assert(alignof(static_vector<char, 2>) == alignof(char), "");
+
+        static_vector<float, 8> v{};
+        BOOST_HANA_RUNTIME_CHECK(v.data() + 7 == &v[7]);
+    }
+
+    // arithmetic
+    {
+        constexpr static_vector<int, 4> u{{1, 2, 3, 4}};
+        constexpr static_vector<int, 4> v{{10, 20, 30, 40}};
+        static_assert(u + v == static_vector<int, 4>{{11, 22, 33, 44}}, "");
+        static_assert(v - u == static_vector<int, 4>{{9, 18, 27, 36}}, "");
+        static_assert(2 * u == static_vector<int, 4>{{2, 4, 6, 8}}, "");
+        static_assert(hana::experimental::dot(u, v) == 300, "");
+
+        static_vector<double, 3> x{{0.5, 1.5, 2.5}};
+        static_vector<double, 3> y{{2.0, 2.0, 2.0}};
+        BOOST_HANA_RUNTIME_CHECK(hana::experimental::dot(x, y) == 9.0);
+        BOOST_HANA_RUNTIME_CHECK(x + y == (static_vector<double, 3>{{2.5, 3.5, 4.5}}));
+    }
+}
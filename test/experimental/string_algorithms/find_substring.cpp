@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+namespace hana = boost::hana;
+using hana::experimental::find_substring;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a")),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("abc")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("ca")),
+        hana::just(hana::size_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("bc")),
+        hana::just(hana::size_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("cb")),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abcd")),
+        hana::nothing
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING_REF("/users/{id}/posts"), BOOST_HANA_STRING("{id}")),
+        hana::just(hana::size_c<7>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        find_substring(BOOST_HANA_STRING_REF("/users/{id}/posts"), BOOST_HANA_STRING_REF("{name}")),
+        hana::nothing
+    ));
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+using hana::experimental::replace_all;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        replace_all(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        replace_all(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("x"), BOOST_HANA_STRING("y")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        replace_all(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("b"), BOOST_HANA_STRING("")),
+        BOOST_HANA_STRING("acac")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        replace_all(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("bc"), BOOST_HANA_STRING("xyz")),
+        BOOST_HANA_STRING("axyzaxyz")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        replace_all(BOOST_HANA_STRING("aaa"), BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("ba")
+    ));
+
+    {
+        auto s = replace_all(BOOST_HANA_STRING_REF("/users/{id}/posts/{id}"),
+                             BOOST_HANA_STRING("{id}"), BOOST_HANA_STRING_REF("42"));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(s, BOOST_HANA_STRING_REF("/users/42/posts/42")));
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(s.c_str(), "/users/42/posts/42") == 0);
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+using hana::experimental::split;
+
+
+int main() {
+    // hana::string
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        split(BOOST_HANA_STRING(""), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING(""))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        split(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("/")),
+        hana::make_tuple(BOOST_HANA_STRING("abc"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        split(BOOST_HANA_STRING("/users/{id}/"), BOOST_HANA_STRING("/")),
+        hana::make_tuple(
+            BOOST_HANA_STRING(""),
+            BOOST_HANA_STRING("users"),
+            BOOST_HANA_STRING("{id}"),
+            BOOST_HANA_STRING("")
+        )
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        split(BOOST_HANA_STRING("a::b::::c"), BOOST_HANA_STRING("::")),
+        hana::make_tuple(
+            BOOST_HANA_STRING("a"),
+            BOOST_HANA_STRING("b"),
+            BOOST_HANA_STRING(""),
+            BOOST_HANA_STRING("c")
+        )
+    ));
+
+    // hana::string_ref
+    {
+        auto pieces = split(BOOST_HANA_STRING_REF("/users/{id}/posts"),
+                            BOOST_HANA_STRING("/"));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::transform(pieces, hana::to<hana::string_tag>),
+            hana::make_tuple(
+                BOOST_HANA_STRING(""),
+                BOOST_HANA_STRING("users"),
+                BOOST_HANA_STRING("{id}"),
+                BOOST_HANA_STRING("posts")
+            )
+        ));
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(pieces[hana::size_c<2>].c_str(), "{id}") == 0);
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(pieces[hana::size_c<3>].c_str(), "posts") == 0);
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+namespace hana = boost::hana;
+using hana::experimental::starts_with;
+using hana::experimental::ends_with;
+
+
+int main() {
+    // starts_with
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")));
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("")));
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("ab")));
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc")));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abcd"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("b"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(starts_with(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"))));
+
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING_REF("ab")));
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING("ab")));
+    BOOST_HANA_CONSTANT_CHECK(starts_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING_REF("ab")));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(starts_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING_REF("bc"))));
+
+    // ends_with
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")));
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("")));
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("bc")));
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("abc")));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("xabc"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(ends_with(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("b"))));
+
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING_REF("bc")));
+    BOOST_HANA_CONSTANT_CHECK(ends_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING("c")));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(ends_with(BOOST_HANA_STRING_REF("abc"), BOOST_HANA_STRING_REF("ab"))));
+}
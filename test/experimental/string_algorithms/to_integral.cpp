@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/string_algorithms.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <climits>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::to_integral;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<int>(BOOST_HANA_STRING("0")),
+        hana::int_c<0>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<int>(BOOST_HANA_STRING("1234")),
+        hana::int_c<1234>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<int>(BOOST_HANA_STRING("+12")),
+        hana::int_c<12>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<int>(BOOST_HANA_STRING_REF("-12")),
+        hana::int_c<-12>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<unsigned long long>(BOOST_HANA_STRING_REF("18446744073709551615")),
+        hana::ullong_c<18446744073709551615ull>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<signed char>(BOOST_HANA_STRING("-128")),
+        hana::integral_c<signed char, -128>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        to_integral<int>(BOOST_HANA_STRING("-2147483648")),
+        hana::int_c<INT_MIN>
+    ));
+
+    {
+        auto one = to_integral<long>(BOOST_HANA_STRING("1"));
+        static_assert(std::is_same<
+            decltype(one), hana::integral_constant<long, 1>
+        >::value, "");
+    }
+}
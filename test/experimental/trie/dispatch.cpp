@@ -0,0 +1,47 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/trie.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::vector<std::string> log;
+    auto routes = hana::experimental::make_trie(hana::make_tuple(
+        hana::make_pair(BOOST_HANA_STRING("get "), [&](std::string const& s) {
+            log.push_back("get " + s);
+        }),
+        hana::make_pair(BOOST_HANA_STRING("set "), [&](std::string const& s) {
+            log.push_back("set " + s);
+        }),
+        hana::make_pair(BOOST_HANA_STRING("quit"), [&](std::string const&) {
+            log.push_back("quit");
+        })
+    ));
+
+    BOOST_HANA_RUNTIME_CHECK(routes.dispatch("get x", std::string{"x"}));
+    BOOST_HANA_RUNTIME_CHECK(routes.dispatch(std::string{"set y"}, std::string{"y"}));
+    BOOST_HANA_RUNTIME_CHECK(!routes.dispatch("put z", std::string{"z"}));
+    BOOST_HANA_RUNTIME_CHECK(!routes.dispatch("ge", std::string{""}));
+    BOOST_HANA_RUNTIME_CHECK(routes.dispatch("quit", std::string{}));
+    BOOST_HANA_RUNTIME_CHECK((log == std::vector<std::string>{"get x", "set y", "quit"}));
+
+    // the matched part of the input can be passed to the handler
+    {
+        std::string rest;
+        auto trie = hana::experimental::make_trie(hana::make_tuple(
+            hana::make_pair(BOOST_HANA_STRING("/files/"), [&](char const* s) { rest = s; })
+        ));
+        char const* path = "/files/a/b";
+        BOOST_HANA_RUNTIME_CHECK(trie.dispatch(path, path + trie.longest_prefix(path).length));
+        BOOST_HANA_RUNTIME_CHECK(rest == "a/b");
+    }
+}
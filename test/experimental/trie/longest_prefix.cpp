@@ -0,0 +1,109 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/trie.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct nothing { void operator()() const { } };
+
+constexpr char users_42[] = "/users/42";
+
+int main() {
+    // matching can happen at compile-time
+    {
+        constexpr auto trie = hana::experimental::make_trie(hana::make_tuple(
+            hana::make_pair(hana::string_c<'/', 'u'>, nothing{}),
+            hana::make_pair(hana::string_c<'/', 'u', 's', 'e', 'r', 's', '/'>, nothing{})
+        ));
+        static_assert(trie.longest_prefix(users_42, users_42 + sizeof(users_42) - 1).key == 1, "");
+        static_assert(trie.longest_prefix(users_42, users_42 + sizeof(users_42) - 1).length == 7, "");
+        static_assert(trie.longest_prefix(users_42, users_42 + 6).key == 0, "");
+    }
+
+    auto routes = hana::experimental::make_trie(hana::make_tuple(
+        hana::make_pair(BOOST_HANA_STRING("/"), nothing{}),
+        hana::make_pair(BOOST_HANA_STRING("/users"), nothing{}),
+        hana::make_pair(BOOST_HANA_STRING("/users/"), nothing{}),
+        hana::make_pair(BOOST_HANA_STRING("/user"), nothing{}),
+        hana::make_pair(BOOST_HANA_STRING("/about"), nothing{}),
+        hana::make_pair(BOOST_HANA_STRING("/abc"), nothing{})
+    ));
+    static_assert(decltype(routes)::size() == 6, "");
+
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/").key == 0);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/u").key == 0);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/use").key == 0);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/user").key == 3);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/users").key == 1);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/usersx").key == 1);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/userx").key == 3);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/ab").key == 0);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/abc/d").key == 5);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("/abc/d").length == 4);
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix(std::string{"/about?x"}).key == 4);
+    BOOST_HANA_RUNTIME_CHECK(!routes.longest_prefix(""));
+    BOOST_HANA_RUNTIME_CHECK(!routes.longest_prefix("users"));
+    BOOST_HANA_RUNTIME_CHECK(routes.longest_prefix("users").length == 0);
+
+    // the empty key matches everything
+    {
+        auto all = hana::experimental::make_trie(hana::make_tuple(
+            hana::make_pair(BOOST_HANA_STRING(""), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("a"), nothing{})
+        ));
+        BOOST_HANA_RUNTIME_CHECK(all.longest_prefix("").key == 0);
+        BOOST_HANA_RUNTIME_CHECK(all.longest_prefix("b").key == 0);
+        BOOST_HANA_RUNTIME_CHECK(all.longest_prefix("ab").key == 1);
+        BOOST_HANA_RUNTIME_CHECK(all.longest_prefix("ab").length == 1);
+    }
+
+    // compare with a linear scan on random inputs, including bytes that
+    // are not ASCII
+    {
+        auto keys = hana::make_tuple(
+            hana::make_pair(BOOST_HANA_STRING("ab"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("abb"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("b\xff"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("ba"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("\xff"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("\xff\x01"), nothing{}),
+            hana::make_pair(BOOST_HANA_STRING("aab"), nothing{})
+        );
+        std::vector<std::string> strings = {"ab", "abb", "b\xff", "ba", "\xff", "\xff\x01", "aab"};
+        auto trie = hana::experimental::make_trie(keys);
+
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> length(0, 5), which(0, 3);
+        char const alphabet[] = {'a', 'b', '\xff', '\x01'};
+        for (int i = 0; i != 5000; ++i) {
+            std::string s(static_cast<std::size_t>(length(gen)), 'a');
+            for (char& c : s)
+                c = alphabet[which(gen)];
+
+            std::size_t expected = static_cast<std::size_t>(-1), longest = 0;
+            for (std::size_t k = 0; k != strings.size(); ++k) {
+                if (s.compare(0, strings[k].size(), strings[k]) == 0 &&
+                    (expected == static_cast<std::size_t>(-1) || strings[k].size() > longest))
+                {
+                    expected = k;
+                    longest = strings[k].size();
+                }
+            }
+
+            auto m = trie.longest_prefix(s);
+            BOOST_HANA_RUNTIME_CHECK(m.key == expected);
+            BOOST_HANA_RUNTIME_CHECK(m.length == longest);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto permuted = hana::experimental::permuted(storage, hana::size_c<0>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(permuted, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto p0 = hana::experimental::permuted(storage, hana::size_c<0>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(p0, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+
+        auto p1 = hana::experimental::permuted(storage, hana::size_c<1>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(p1, f),
+            f(ct_eq<0>{}, ct_eq<2>{}, ct_eq<1>{})
+        ));
+
+        auto p3 = hana::experimental::permuted(storage, hana::size_c<3>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(p3, f),
+            f(ct_eq<1>{}, ct_eq<2>{}, ct_eq<0>{})
+        ));
+
+        auto p5 = hana::experimental::permuted(storage, hana::size_c<5>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(p5, f),
+            f(ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // Only the requested permutation is computed, even when there are
+    // too many permutations to compute them all.
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{},
+                                 ct_eq<4>{}, ct_eq<5>{}, ct_eq<6>{}, ct_eq<7>{},
+                                 ct_eq<8>{}, ct_eq<9>{});
+        auto last = hana::experimental::permuted(storage, hana::size_c<3628799>);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(last, f),
+            f(ct_eq<9>{}, ct_eq<8>{}, ct_eq<7>{}, ct_eq<6>{}, ct_eq<5>{},
+              ct_eq<4>{}, ct_eq<3>{}, ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+}
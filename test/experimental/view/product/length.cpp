@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto product = hana::experimental::product_view();
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(product), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(product));
+    }{
+        auto storage = container();
+        auto product = hana::experimental::product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(product), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(product));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container();
+        auto product = hana::experimental::product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(product), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(product));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto product = hana::experimental::product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(product), hana::size_c<2>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(product)));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{});
+        auto storage3 = container(ct_eq<5>{}, ct_eq<6>{});
+        auto product = hana::experimental::product_view(storage1, storage2, storage3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(product), hana::size_c<12>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(product)));
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto product = hana::experimental::product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f()
+        ));
+    }{
+        auto storage1 = container(ct_eq<0>{});
+        auto storage2 = container();
+        auto product = hana::experimental::product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{});
+        auto product = hana::experimental::product_view(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f(hana::make_tuple(ct_eq<0>{}), hana::make_tuple(ct_eq<1>{}))
+        ));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{}, ct_eq<3>{});
+        auto product = hana::experimental::product_view(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f(hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}),
+              hana::make_tuple(ct_eq<0>{}, ct_eq<3>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<3>{}))
+        ));
+    }{
+        auto storage1 = container(ct_eq<0>{}, ct_eq<1>{});
+        auto storage2 = container(ct_eq<2>{});
+        auto storage3 = container(ct_eq<3>{}, ct_eq<4>{});
+        auto product = hana::experimental::product_view(storage1, storage2, storage3);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(product, f),
+            f(hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}, ct_eq<3>{}),
+              hana::make_tuple(ct_eq<0>{}, ct_eq<2>{}, ct_eq<4>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}),
+              hana::make_tuple(ct_eq<1>{}, ct_eq<2>{}, ct_eq<4>{}))
+        ));
+    }
+}
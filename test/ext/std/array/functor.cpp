@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/array.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/functor.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <array>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct twice {
+    constexpr long operator()(int i) const { return i * 2L; }
+};
+
+struct minus {
+    constexpr int operator()(int x, int y) const { return x - y; }
+};
+
+int main() {
+    static_assert(hana::Functor<hana::ext::std::array_tag>::value, "");
+
+    // transform
+    {
+        std::array<int, 0> empty{};
+        auto e = hana::transform(empty, [](int i) { return i * 2.0; });
+        static_assert(std::is_same<decltype(e), std::array<double, 0>>{}, "");
+
+        constexpr std::array<int, 3> a = {{1, 2, 3}};
+        constexpr auto b = hana::transform(a, twice{});
+        static_assert(std::is_same<decltype(b), std::array<long, 3> const>{}, "");
+        static_assert(b[0] == 2 && b[1] == 4 && b[2] == 6, "");
+
+        // the function is applied in order
+        std::array<int, 3> c = {{1, 2, 3}};
+        int calls = 0;
+        auto d = hana::transform(c, [&](int& i) -> int& { i += calls++; return i; });
+        BOOST_HANA_RUNTIME_CHECK(d == (std::array<int, 3>{{1, 3, 5}}));
+        BOOST_HANA_RUNTIME_CHECK(c == (std::array<int, 3>{{1, 3, 5}}));
+    }
+
+    // fold_left
+    {
+        constexpr std::array<int, 4> a = {{1, 2, 3, 4}};
+        static_assert(hana::fold_left(a, 10, minus{}) == 0, "");
+        static_assert(hana::fold_left(a, minus{}) == -8, "");
+    }
+
+    // for_each
+    {
+        std::array<int, 3> a = {{1, 2, 3}};
+        int sum = 0;
+        hana::for_each(a, [&](int& i) { sum = sum * 10 + i; i = 0; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 123);
+        BOOST_HANA_RUNTIME_CHECK(a == (std::array<int, 3>{{0, 0, 0}}));
+    }
+}
@@ -0,0 +1,53 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/variant.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <string>
+#include <variant>
+namespace hana = boost::hana;
+
+
+std::string show(int i) { return std::to_string(i); }
+std::string show(std::string const& s) { return '"' + s + '"'; }
+
+int main() {
+    static_assert(hana::Foldable<hana::ext::std::variant_tag>::value, "");
+    static_assert(!hana::Searchable<hana::ext::std::variant_tag>::value, "");
+
+    std::variant<int, std::string> v{std::string{"abc"}};
+
+    // unpack
+    {
+        auto count = hana::unpack(v, [](auto const& ...x) { return sizeof...(x); });
+        BOOST_HANA_RUNTIME_CHECK(count == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(v, [](auto const& x) { return show(x); }) == "\"abc\"");
+    }
+
+    // fold_left
+    {
+        std::string s = hana::fold_left(v, std::string{"v="}, [](std::string state, auto const& x) {
+            return state + show(x);
+        });
+        BOOST_HANA_RUNTIME_CHECK(s == "v=\"abc\"");
+    }
+
+    // for_each
+    {
+        v = 3;
+        int calls = 0;
+        hana::for_each(v, [&](auto const& x) {
+            ++calls;
+            BOOST_HANA_RUNTIME_CHECK(show(x) == "3");
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+}
@@ -0,0 +1,96 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/variant.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <laws/base.hpp> // for move_only
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+namespace hana = boost::hana;
+
+
+struct thrower {
+    thrower() = default;
+    thrower(thrower const&) { throw std::runtime_error{"thrower"}; }
+    thrower& operator=(thrower const&) = default;
+};
+
+int main() {
+    // one variant
+    {
+        std::variant<int, char, std::string> v{'x'};
+        auto index = [](auto const& x) {
+            if constexpr (std::is_same_v<decltype(x), int const&>) return 0;
+            else if constexpr (std::is_same_v<decltype(x), char const&>) return 1;
+            else return 2;
+        };
+        BOOST_HANA_RUNTIME_CHECK(hana::visit(index, v) == 1);
+        v = 3;
+        BOOST_HANA_RUNTIME_CHECK(hana::visit(index, v) == 0);
+        v = std::string{"abc"};
+        BOOST_HANA_RUNTIME_CHECK(hana::visit(index, v) == 2);
+    }
+
+    // every combination of alternatives of several variants is dispatched
+    // to the right function
+    {
+        auto f = [](auto a, auto b, auto c) {
+            return std::to_string(sizeof(a)) + std::to_string(sizeof(b))
+                                             + std::to_string(sizeof(c));
+        };
+        using V = std::variant<char, short, int>;
+        using W = std::variant<long long, char>;
+        V const vs[] = {V{char{}}, V{short{}}, V{int{}}};
+        W const ws[] = {W{0LL}, W{char{}}};
+        for (V const& v1 : vs)
+            for (W const& w : ws)
+                for (V const& v2 : vs)
+                    BOOST_HANA_RUNTIME_CHECK(hana::visit(f, v1, w, v2) ==
+                                             std::visit(f, v1, w, v2));
+    }
+
+    // alternatives are forwarded with the value category of the variant
+    {
+        std::variant<int, std::string> v{std::string{"abc"}};
+        hana::visit([](auto& x) { x = x + x; }, v);
+        BOOST_HANA_RUNTIME_CHECK(std::get<std::string>(v) == "abcabc");
+
+        std::variant<hana::test::move_only, int> m{};
+        bool moved = hana::visit([](auto&& x) {
+            return std::is_rvalue_reference<decltype(x)>::value;
+        }, std::move(m));
+        BOOST_HANA_RUNTIME_CHECK(moved);
+    }
+
+    // the function object is forwarded
+    {
+        struct f {
+            int operator()(int) const& { return 1; }
+            int operator()(int) && { return 2; }
+        };
+        std::variant<int> v{0};
+        f const g{};
+        BOOST_HANA_RUNTIME_CHECK(hana::visit(g, v) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit(f{}, v) == 2);
+    }
+
+    // valueless variants throw std::bad_variant_access
+    {
+        std::variant<int, thrower> v{0};
+        try { v = thrower{}; } catch (std::runtime_error const&) { }
+        BOOST_HANA_RUNTIME_CHECK(v.valueless_by_exception());
+
+        std::variant<int> w{0};
+        bool thrown = false;
+        try { hana::visit([](auto, auto) { }, w, v); }
+        catch (std::bad_variant_access const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/lazy.hpp>
+
+#include <boost/hana/ap.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/flatten.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <memory>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+// Chains of transform, ap and chain are represented as a single lazy call
+// on the original arguments, not as lazy calls on nested lazy expressions.
+template <typename ...Args>
+constexpr bool none_lazy() {
+    bool lazy[] = {false, std::is_same<hana::tag_of_t<Args>, hana::lazy_tag>::value...};
+    for (bool b : lazy)
+        if (b) return false;
+    return true;
+}
+
+template <typename Expr>
+struct is_flat : std::false_type { };
+
+template <std::size_t ...n, typename F, typename ...Args>
+struct is_flat<hana::lazy_apply_t<std::index_sequence<n...>, F, Args...>>
+    : std::integral_constant<bool, none_lazy<Args...>()>
+{ };
+
+struct inc_t {
+    template <typename X>
+    constexpr X operator()(X x) const { return x + 1; }
+};
+constexpr inc_t inc{};
+
+int main() {
+    // transform
+    {
+        auto x = hana::transform(hana::transform(hana::transform(
+            hana::make_lazy(1), inc), inc), inc);
+        static_assert(is_flat<decltype(x)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 4);
+
+        auto y = hana::transform(hana::transform(
+            hana::make_lazy([](int a, int b) { return a * b; })(3, 4), inc), inc);
+        static_assert(is_flat<decltype(y)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(y) == 14);
+
+        // in constant expressions
+        BOOST_HANA_CONSTEXPR_LAMBDA auto z = hana::transform(hana::transform(
+            hana::make_lazy(inc)(1), inc), inc);
+        BOOST_HANA_CONSTEXPR_CHECK(hana::eval(z) == 4);
+    }
+
+    // ap
+    {
+        auto x = hana::ap(hana::make_lazy(inc), hana::transform(hana::make_lazy(1), inc));
+        static_assert(is_flat<decltype(x)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 3);
+
+        auto plus = hana::make_lazy([](int a, int b, int c) { return a + b + c; });
+        auto y = hana::ap(plus, hana::make_lazy(1), hana::make_lazy(10), hana::make_lazy(100));
+        static_assert(is_flat<decltype(y)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(y) == 111);
+
+        // neither the function nor the argument are lazy values
+        auto z = hana::ap(hana::transform(hana::make_lazy(1), [](int a) {
+            return [a](int b) { return a - b; };
+        }), hana::transform(hana::make_lazy(3), inc));
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(z) == -3);
+    }
+
+    // flatten and chain
+    {
+        auto x = hana::flatten(hana::make_lazy(hana::make_lazy(inc)(1)));
+        static_assert(is_flat<decltype(x)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(x) == 2);
+
+        auto lazy_inc = [](int a) { return hana::make_lazy(inc)(a); };
+        auto y = hana::chain(hana::chain(hana::make_lazy(1), lazy_inc), lazy_inc);
+        static_assert(is_flat<decltype(y)>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(y) == 3);
+    }
+
+    // move-only values are moved through rvalue chains
+    {
+        auto x = hana::transform(hana::transform(
+            hana::make_lazy(std::make_unique<int>(1)),
+            [](std::unique_ptr<int> p) { ++*p; return p; }),
+            [](std::unique_ptr<int> p) { ++*p; return p; });
+        BOOST_HANA_RUNTIME_CHECK(*hana::eval(std::move(x)) == 3);
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/lazy.hpp>
+
+#include <boost/hana/ap.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/chain.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/eval.hpp>
+#include <boost/hana/flatten.hpp>
+#include <boost/hana/transform.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct Counter {
+    int* calls;
+    int operator()(int x) const { ++*calls; return x * 2; }
+};
+
+int main() {
+    // evaluates at most once, and only when needed
+    {
+        int calls = 0;
+        auto memo = hana::memoize(hana::make_lazy(Counter{&calls})(21));
+        static_assert(std::is_same<hana::tag_of_t<decltype(memo)>, hana::lazy_tag>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(memo) == 42);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(memo) == 42);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+        // lvalues evaluate to a reference to the memoized result
+        BOOST_HANA_RUNTIME_CHECK(&hana::eval(memo) == &hana::eval(memo));
+    }
+
+    // copies and derived expressions share the result
+    {
+        int calls = 0;
+        auto memo = hana::memoize(hana::make_lazy(Counter{&calls})(1));
+        auto copy = memo;
+        auto plus1 = hana::transform(memo, [](int x) { return x + 1; });
+        auto chained = hana::chain(memo, [](int x) { return hana::make_lazy(x * 10); });
+        auto applied = hana::ap(hana::make_lazy([](int x) { return -x; }), memo);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(plus1) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(chained) == 20);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(applied) == -2);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(copy) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(std::move(copy)) == 2);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+
+    // memoizing a lazy value, and a memoized value
+    {
+        auto memo = hana::memoize(hana::make_lazy(std::string{"abc"}));
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(memo) == "abc");
+
+        int calls = 0;
+        auto twice = hana::memoize(hana::memoize(hana::make_lazy(Counter{&calls})(2)));
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(twice) == 4);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(twice) == 4);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+
+    // an expression throwing an exception is evaluated again
+    {
+        int calls = 0;
+        auto memo = hana::memoize(hana::make_lazy([&calls] {
+            if (++calls == 1)
+                throw std::runtime_error{"first"};
+            return calls;
+        })());
+        bool caught = false;
+        try { hana::eval(memo); } catch (std::runtime_error const&) { caught = true; }
+        BOOST_HANA_RUNTIME_CHECK(caught);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(memo) == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::eval(memo) == 2);
+    }
+
+    // the synchronized version evaluates once across threads
+    {
+        std::atomic<int> calls{0};
+        auto memo = hana::memoize_synchronized(hana::make_lazy([&calls] {
+            ++calls;
+            std::this_thread::yield();
+            return std::vector<int>(100, 1);
+        })());
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i != 4; ++i) {
+            threads.emplace_back([memo] {
+                BOOST_HANA_RUNTIME_CHECK(hana::eval(memo).size() == 100);
+            });
+        }
+        for (std::thread& t : threads)
+            t.join();
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include <support/triviality.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename ...T>
+struct map_of;
+
+template <>
+struct map_of<> {
+    using type = hana::map<>;
+};
+
+template <typename T>
+struct map_of<T> {
+    using type = hana::map<hana::pair<hana::int_<0>, T>>;
+};
+
+template <typename T, typename U>
+struct map_of<T, U> {
+    using type = hana::map<hana::pair<hana::int_<0>, T>, hana::pair<hana::int_<1>, U>>;
+};
+
+template <typename ...T>
+using check = check_triviality<typename map_of<T...>::type, T...>;
+
+int main() {
+    check<>{};
+    check<int>{};
+    check<int, TrivialEmpty>{};
+    check<Trivial, double*>{};
+    check<NonTrivialCopy>{};
+    check<int, NonTrivialMove>{};
+    check<NonTrivialAssign, TrivialEmpty>{};
+    check<int, NonTrivialDestructor>{};
+    check<std::string>{};
+}
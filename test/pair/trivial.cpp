@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/pair.hpp>
+
+#include <support/triviality.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename T, typename U>
+using check = check_triviality<hana::pair<T, U>, T, U>;
+
+int main() {
+    check<int, int>{};
+    check<int, TrivialEmpty>{};
+    check<TrivialEmpty, TrivialEmpty>{};
+    check<Trivial, double*>{};
+    check<int, NonTrivialCopy>{};
+    check<NonTrivialMove, int>{};
+    check<TrivialEmpty, NonTrivialAssign>{};
+    check<NonTrivialDestructor, int>{};
+    check<std::string, int>{};
+}
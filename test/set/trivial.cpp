@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+
+#include <support/triviality.hpp>
+namespace hana = boost::hana;
+
+
+// The elements of a set are known at compile-time, so a set is always
+// trivial, except for its default constructor.
+int main() {
+    check_triviality<decltype(hana::make_set())>{};
+    check_triviality<
+        decltype(hana::make_set(hana::int_c<0>, hana::int_c<1>, hana::int_c<2>))
+    >{};
+    check_triviality<
+        decltype(hana::make_set(hana::type_c<int>, hana::type_c<char>))
+    >{};
+}
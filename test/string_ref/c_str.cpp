@@ -0,0 +1,62 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/string_ref.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+
+
+struct hello { static constexpr decltype(auto) get() { return "hello"; } };
+struct world { static constexpr decltype(auto) get() { return " world"; } };
+
+constexpr char const* s1 = hana::string_ref_c<hello>.c_str();
+static_assert(s1[0] == 'h' && s1[4] == 'o' && s1[5] == '\0', "");
+static_assert(hana::string_ref_c<hello>.size() == 5, "");
+
+constexpr char const* s2 = hana::to<char const*>(
+    hana::string_ref_c<hello> + hana::string_ref_c<world>
+);
+static_assert(s2[5] == ' ' && s2[10] == 'd' && s2[11] == '\0', "");
+
+constexpr char const* s3 = hana::drop_front(hana::string_ref_c<hello>,
+                                            hana::size_c<3>).c_str();
+static_assert(s3[0] == 'l' && s3[1] == 'o' && s3[2] == '\0', "");
+
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(std::strcmp(
+        BOOST_HANA_STRING_REF("").c_str(),
+        ""
+    ) == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(std::strcmp(
+        BOOST_HANA_STRING_REF("abcd").c_str(),
+        "abcd"
+    ) == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(std::strcmp(
+        (BOOST_HANA_STRING_REF("ab") + BOOST_HANA_STRING_REF("cd")).c_str(),
+        "abcd"
+    ) == 0);
+
+    BOOST_HANA_RUNTIME_CHECK(std::strcmp(
+        hana::drop_front(BOOST_HANA_STRING_REF("abcd"), hana::size_c<2>).c_str(),
+        "cd"
+    ) == 0);
+
+    // slices of slices refer to the original string
+    {
+        auto s = BOOST_HANA_STRING_REF("abcdef");
+        auto a = hana::drop_front(hana::drop_front(s, hana::size_c<1>),
+                                  hana::size_c<2>);
+        auto b = hana::drop_front(s, hana::size_c<3>);
+        static_assert(std::is_same<decltype(a), decltype(b)>::value, "");
+        BOOST_HANA_RUNTIME_CHECK(std::strcmp(a.c_str(), "def") == 0);
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/string_ref.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/hashable.hpp>
+#include <laws/iterable.hpp>
+#include <laws/monoid.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Comparable and Hashable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING_REF(""),
+            BOOST_HANA_STRING_REF("a"),
+            BOOST_HANA_STRING_REF("ab"),
+            BOOST_HANA_STRING_REF("abc"),
+            BOOST_HANA_STRING_REF("abcd"),
+            BOOST_HANA_STRING_REF("abcde"),
+            BOOST_HANA_STRING_REF("ba")
+        );
+
+        hana::test::TestComparable<hana::string_ref_tag>{strings};
+        hana::test::TestHashable<hana::string_ref_tag>{strings};
+    }
+
+    // Monoid
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING_REF(""),
+            BOOST_HANA_STRING_REF("a"),
+            BOOST_HANA_STRING_REF("ab"),
+            BOOST_HANA_STRING_REF("abc"),
+            BOOST_HANA_STRING_REF("abcd"),
+            BOOST_HANA_STRING_REF("abcde"),
+            BOOST_HANA_STRING_REF("ba")
+        );
+
+        hana::test::TestMonoid<hana::string_ref_tag>{strings};
+    }
+
+    // Foldable and Iterable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING_REF(""),
+            BOOST_HANA_STRING_REF("a"),
+            BOOST_HANA_STRING_REF("ab"),
+            BOOST_HANA_STRING_REF("abc"),
+            BOOST_HANA_STRING_REF("abcd"),
+            BOOST_HANA_STRING_REF("abcde"),
+            BOOST_HANA_STRING_REF("ba"),
+            BOOST_HANA_STRING_REF("afcd")
+        );
+
+        hana::test::TestFoldable<hana::string_ref_tag>{strings};
+        hana::test::TestIterable<hana::string_ref_tag>{strings};
+    }
+
+    // Orderable
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING_REF(""),
+            BOOST_HANA_STRING_REF("a"),
+            BOOST_HANA_STRING_REF("ab"),
+            BOOST_HANA_STRING_REF("abc"),
+            BOOST_HANA_STRING_REF("ba"),
+            BOOST_HANA_STRING_REF("abd")
+        );
+
+        hana::test::TestOrderable<hana::string_ref_tag>{strings};
+    }
+
+    // Searchable
+    {
+        auto keys = hana::tuple_c<char, 'a', 'f'>;
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING_REF(""),
+            BOOST_HANA_STRING_REF("a"),
+            BOOST_HANA_STRING_REF("ab"),
+            BOOST_HANA_STRING_REF("abcd"),
+            BOOST_HANA_STRING_REF("ba"),
+            BOOST_HANA_STRING_REF("afcd")
+        );
+
+        hana::test::TestSearchable<hana::string_ref_tag>{strings, keys};
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/not_equal.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/string_ref.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // to<string_tag>
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::string_tag>(BOOST_HANA_STRING_REF("")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::to<hana::string_tag>(BOOST_HANA_STRING_REF("abc")),
+        BOOST_HANA_STRING("abc")
+    ));
+
+    // strings with the same contents but keyed by different types are equal
+    // and have the same hash
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        BOOST_HANA_STRING_REF("abc"),
+        BOOST_HANA_STRING_REF("ab") + BOOST_HANA_STRING_REF("c")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::hash(BOOST_HANA_STRING_REF("abc")),
+        hana::hash(BOOST_HANA_STRING_REF("ab") + BOOST_HANA_STRING_REF("c"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_equal(
+        hana::hash(BOOST_HANA_STRING_REF("abc")),
+        hana::hash(BOOST_HANA_STRING_REF("abd"))
+    ));
+}
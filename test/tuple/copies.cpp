@@ -0,0 +1,145 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adjust_if.hpp>
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concat.hpp>
+#include <boost/hana/cycle.hpp>
+#include <boost/hana/drop_back.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/drop_front_exactly.hpp>
+#include <boost/hana/drop_while.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/functional/arg.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/insert_range.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/intersperse.hpp>
+#include <boost/hana/partition.hpp>
+#include <boost/hana/prefix.hpp>
+#include <boost/hana/prepend.hpp>
+#include <boost/hana/remove_at.hpp>
+#include <boost/hana/remove_if.hpp>
+#include <boost/hana/remove_range.hpp>
+#include <boost/hana/replace_if.hpp>
+#include <boost/hana/reverse.hpp>
+#include <boost/hana/scan_left.hpp>
+#include <boost/hana/scan_right.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/span.hpp>
+#include <boost/hana/suffix.hpp>
+#include <boost/hana/take_back.hpp>
+#include <boost/hana/take_front.hpp>
+#include <boost/hana/take_while.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unique.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/zip.hpp>
+
+#include <support/counted.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// This test makes sure that the algorithms on Sequences do not copy their
+// elements more than expected. Each algorithm is called with a tuple of
+// 4 elements, once as an lvalue and once as an rvalue, and the number of
+// copies it performs is checked, including the copies of elements that the
+// algorithm adds to the sequence. The `benchmark/copies` benchmark reports
+// the same numbers, along with the number of moves.
+
+auto make_input() {
+    return hana::make_tuple(Counted{"a"}, Counted{"b"}, Counted{"c"}, Counted{"d"});
+}
+
+template <typename F>
+void check(F f, int lvalue_copies, int rvalue_copies) {
+    {
+        auto xs = make_input();
+        Counted::counts() = Counted::Counts{};
+        f(xs);
+        BOOST_HANA_RUNTIME_CHECK(Counted::counts().copies == lvalue_copies);
+        BOOST_HANA_RUNTIME_CHECK(Counted::counts().alive() == 0);
+    }{
+        auto xs = make_input();
+        Counted::counts() = Counted::Counts{};
+        f(std::move(xs));
+        BOOST_HANA_RUNTIME_CHECK(Counted::counts().copies == rvalue_copies);
+        BOOST_HANA_RUNTIME_CHECK(Counted::counts().alive() == 0);
+    }
+}
+
+#define FWD(x) static_cast<decltype(x)&&>(x)
+
+int main() {
+    auto yes = [](auto const& ...) { return hana::true_c; };
+    auto no = [](auto const& ...) { return hana::false_c; };
+    auto z = [] { return Counted{"z"}; };
+
+    check([=](auto&& xs) { return hana::adjust_if(FWD(xs), no, hana::id); }, 4, 0);
+    check([=](auto&& xs) { return hana::append(FWD(xs), z()); }, 4, 0);
+    check([](auto&& xs) { return hana::concat(FWD(xs), hana::make_tuple()); }, 4, 0);
+    check([](auto&& xs) { return hana::cycle(FWD(xs), hana::size_c<2>); }, 8, 8);
+    check([](auto&& xs) { return hana::drop_back(FWD(xs), hana::size_c<1>); }, 3, 0);
+    check([](auto&& xs) { return hana::drop_front(FWD(xs), hana::size_c<1>); }, 3, 0);
+    check([](auto&& xs) { return hana::drop_front_exactly(FWD(xs), hana::size_c<1>); }, 3, 0);
+    check([=](auto&& xs) { return hana::drop_while(FWD(xs), no); }, 4, 0);
+    check([=](auto&& xs) { return hana::filter(FWD(xs), yes); }, 4, 0);
+    check([](auto&& xs) {
+        return hana::fold_left(FWD(xs), 0, [](int n, auto const&) { return n + 1; });
+    }, 0, 0);
+    check([](auto&& xs) { hana::for_each(FWD(xs), [](auto const&) { }); }, 0, 0);
+    check([=](auto&& xs) { return hana::group(FWD(xs), no); }, 4, 0);
+    check([=](auto&& xs) { return hana::insert(FWD(xs), hana::size_c<1>, z()); }, 4, 0);
+    check([=](auto&& xs) {
+        return hana::insert_range(FWD(xs), hana::size_c<1>, hana::make_tuple(z()));
+    }, 4, 0);
+    check([=](auto&& xs) { return hana::intersperse(FWD(xs), z()); }, 7, 3);
+    check([=](auto&& xs) { return hana::partition(FWD(xs), yes); }, 4, 0);
+    check([=](auto&& xs) { return hana::prefix(FWD(xs), z()); }, 8, 4);
+    check([=](auto&& xs) { return hana::prepend(FWD(xs), z()); }, 4, 0);
+    check([](auto&& xs) { return hana::remove_at(FWD(xs), hana::size_c<0>); }, 3, 0);
+    check([=](auto&& xs) { return hana::remove_if(FWD(xs), no); }, 4, 0);
+    check([](auto&& xs) {
+        return hana::remove_range(FWD(xs), hana::size_c<0>, hana::size_c<1>);
+    }, 3, 0);
+    check([=](auto&& xs) { return hana::replace_if(FWD(xs), no, z()); }, 4, 0);
+    check([](auto&& xs) { return hana::reverse(FWD(xs)); }, 4, 0);
+    check([](auto&& xs) { return hana::scan_left(FWD(xs), hana::arg<2>); }, 4, 0);
+    check([](auto&& xs) { return hana::scan_right(FWD(xs), hana::arg<1>); }, 4, 0);
+    check([](auto&& xs) {
+        return hana::slice(FWD(xs), hana::tuple_c<std::size_t, 3, 2, 1, 0>);
+    }, 4, 0);
+    check([=](auto&& xs) { return hana::sort(FWD(xs), no); }, 4, 0);
+    check([=](auto&& xs) { return hana::span(FWD(xs), yes); }, 4, 0);
+    check([=](auto&& xs) { return hana::suffix(FWD(xs), z()); }, 8, 4);
+    check([](auto&& xs) { return hana::take_back(FWD(xs), hana::size_c<4>); }, 4, 0);
+    check([](auto&& xs) { return hana::take_front(FWD(xs), hana::size_c<4>); }, 4, 0);
+    check([=](auto&& xs) { return hana::take_while(FWD(xs), yes); }, 4, 0);
+    check([](auto&& xs) {
+        return hana::transform(FWD(xs), [](auto&& x) { return FWD(x); });
+    }, 4, 0);
+    check([=](auto&& xs) { return hana::unique(FWD(xs), no); }, 4, 0);
+    check([](auto&& xs) { hana::unpack(FWD(xs), [](auto const& ...) { }); }, 0, 0);
+    check([](auto&& xs) { return hana::zip(FWD(xs)); }, 4, 4);
+
+    // Make sure that an element added at several places in the sequence is
+    // not moved from more than once.
+    {
+        auto result = hana::intersperse(make_input(), Counted{"z"});
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(result).value == "z");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<3>(result).value == "z");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<5>(result).value == "z");
+    }
+}
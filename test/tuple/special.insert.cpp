@@ -0,0 +1,81 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/insert_range.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+// Make sure that insert and insert_range create their result directly,
+// which means that each element is copied or moved exactly once.
+
+struct MoveOnly {
+    MoveOnly() = default;
+    MoveOnly(MoveOnly&&) = default;
+    MoveOnly(MoveOnly const&) = delete;
+};
+
+struct Counted {
+    static int copies;
+    static int moves;
+    Counted() = default;
+    Counted(Counted const&) { ++copies; }
+    Counted(Counted&&) { ++moves; }
+    static void reset() { copies = moves = 0; }
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+int main() {
+    // insert
+    {
+        auto xs = hana::make_tuple(MoveOnly{}, MoveOnly{});
+        auto ys = hana::insert(std::move(xs), hana::size_c<1>, MoveOnly{});
+        (void)ys;
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::insert(std::move(xs), hana::size_c<1>, Counted{});
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 4);
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        Counted c;
+        Counted::reset();
+        auto ys = hana::insert(xs, hana::size_c<3>, c);
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 4);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 0);
+    }
+
+    // insert_range
+    {
+        auto xs = hana::make_tuple(MoveOnly{}, MoveOnly{});
+        auto ys = hana::insert_range(std::move(xs), hana::size_c<1>,
+                                     hana::make_tuple(MoveOnly{}, MoveOnly{}));
+        (void)ys;
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        auto zs = hana::make_tuple(Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::insert_range(std::move(xs), hana::size_c<2>, std::move(zs));
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 5);
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        auto zs = hana::make_tuple(Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::insert_range(xs, hana::size_c<0>, zs);
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 5);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 0);
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/slice.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <utility>
+namespace hana = boost::hana;
+
+
+// Make sure that slice moves from a temporary sequence when no index is
+// repeated, and copies otherwise.
+
+struct MoveOnly {
+    MoveOnly() = default;
+    MoveOnly(MoveOnly&&) = default;
+    MoveOnly(MoveOnly const&) = delete;
+};
+
+struct Counted {
+    static int copies;
+    static int moves;
+    Counted() = default;
+    Counted(Counted const&) { ++copies; }
+    Counted(Counted&&) { ++moves; }
+    static void reset() { copies = moves = 0; }
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+int main() {
+    {
+        auto xs = hana::make_tuple(MoveOnly{}, MoveOnly{}, MoveOnly{});
+        auto ys = hana::slice(std::move(xs), hana::tuple_c<std::size_t, 2, 0>);
+        (void)ys;
+    }{
+        auto xs = hana::make_tuple(MoveOnly{}, MoveOnly{});
+        auto ys = hana::slice(std::move(xs), hana::tuple_c<std::size_t>);
+        (void)ys;
+    }
+
+    {
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::slice(std::move(xs), hana::tuple_c<std::size_t, 2, 0, 1>);
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 3);
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::slice(std::move(xs), hana::tuple_c<std::size_t, 1, 0, 1>);
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 3);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 0);
+    }{
+        auto xs = hana::make_tuple(Counted{}, Counted{}, Counted{});
+        Counted::reset();
+        auto ys = hana::slice(xs, hana::tuple_c<std::size_t, 2, 0>);
+        (void)ys;
+        BOOST_HANA_RUNTIME_CHECK(Counted::copies == 2);
+        BOOST_HANA_RUNTIME_CHECK(Counted::moves == 0);
+    }
+}
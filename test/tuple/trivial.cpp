@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2017
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/tuple.hpp>
+
+#include <support/triviality.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+template <typename ...T>
+using check = check_triviality<hana::tuple<T...>, T...>;
+
+int main() {
+    check<>{};
+    check<int>{};
+    check<int, char, TrivialEmpty>{};
+    check<Trivial, double*, Trivial>{};
+    check<NonTrivialCopy>{};
+    check<int, NonTrivialMove>{};
+    check<NonTrivialAssign, TrivialEmpty, int>{};
+    check<int, NonTrivialDestructor>{};
+    check<std::string>{};
+}